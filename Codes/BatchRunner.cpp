@@ -0,0 +1,287 @@
+#include "BatchRunner.h"
+#include <thread>
+#include <map>
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * Constructor for BatchRunner class
+ * @param threads Worker threads to use (0 for one per core)
+ * @param playerPolicy Chooses the simulated player's moves
+ */
+BatchRunner::BatchRunner(int threads, PlayerPolicy playerPolicy)
+    : threadCount(threads), policy(playerPolicy) {
+    if (threadCount <= 0) {
+        threadCount = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    if (threadCount <= 0) {
+        threadCount = 1;
+    }
+}
+
+/**
+ * Play every job and store its result
+ * Blocks until all jobs are done. results[i] always belongs to jobs[i],
+ * whichever thread played it.
+ * @param jobs Games to play
+ * @param results Receives one result per job
+ */
+void BatchRunner::run(const std::vector<BatchJob>& jobs, std::vector<BatchResult>& results) const {
+    results.resize(jobs.size());
+    if (jobs.empty()) {
+        return;
+    }
+
+    // No point in more workers than jobs
+    const int workers = static_cast<int>(std::min(jobs.size(), static_cast<size_t>(threadCount)));
+
+    // Equal contiguous slices to start with; stealing evens out the rest
+    std::vector<WorkRange> ranges(workers);
+    for (int i = 0; i < workers; i++) {
+        ranges[i].begin = jobs.size() * i / workers;
+        ranges[i].end = jobs.size() * (i + 1) / workers;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+    for (int i = 1; i < workers; i++) {
+        threads.push_back(std::thread(&BatchRunner::workerLoop, this, std::cref(jobs),
+                                      std::ref(results), std::ref(ranges), i));
+    }
+    workerLoop(jobs, results, ranges, 0); // The calling thread is worker 0
+
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+}
+
+/**
+ * Play jobs until there are none left anywhere
+ * @param jobs Games to play
+ * @param results Receives one result per job
+ * @param ranges Remaining job indices of every worker
+ * @param worker Index of this worker
+ */
+void BatchRunner::workerLoop(const std::vector<BatchJob>& jobs, std::vector<BatchResult>& results,
+                             std::vector<WorkRange>& ranges, int worker) const {
+    size_t job;
+    while (takeJob(ranges, worker, job)) {
+        results[job] = playJob(jobs[job]);
+    }
+}
+
+/**
+ * Take the next job for a worker
+ * Takes from the front of the worker's own range; once that is empty,
+ * moves the back half of the fullest other range over and takes from it.
+ * Jobs are whole games, so the lock per take is noise next to the work.
+ * @param ranges Remaining job indices of every worker
+ * @param worker Index of the worker asking
+ * @param job Receives the job index
+ * @return false once every range is empty
+ */
+bool BatchRunner::takeJob(std::vector<WorkRange>& ranges, int worker, size_t& job) const {
+    WorkRange& own = ranges[worker];
+    {
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (own.begin < own.end) {
+            job = own.begin++;
+            return true;
+        }
+    }
+
+    const int workers = static_cast<int>(ranges.size());
+    for (;;) {
+        // Pick the victim with the most work left
+        int victim = -1;
+        size_t mostLeft = 0;
+        for (int i = 1; i < workers; i++) {
+            WorkRange& other = ranges[(worker + i) % workers];
+            std::lock_guard<std::mutex> lock(other.mutex);
+            const size_t left = other.end - other.begin;
+            if (left > mostLeft) {
+                mostLeft = left;
+                victim = (worker + i) % workers;
+            }
+        }
+        if (victim < 0) {
+            return false; // Nothing left anywhere
+        }
+
+        size_t stolenBegin, stolenEnd;
+        {
+            WorkRange& other = ranges[victim];
+            std::lock_guard<std::mutex> lock(other.mutex);
+            const size_t left = other.end - other.begin;
+            if (left == 0) {
+                continue; // Drained while we looked; try again
+            }
+            // Leave the victim the front half (it is working from the front)
+            stolenEnd = other.end;
+            stolenBegin = other.end - (left + 1) / 2;
+            other.end = stolenBegin;
+        }
+
+        job = stolenBegin;
+        std::lock_guard<std::mutex> lock(own.mutex);
+        own.begin = stolenBegin + 1;
+        own.end = stolenEnd;
+        return true;
+    }
+}
+
+/**
+ * Play one game to completion on the calling thread
+ * The game ends when the player reaches the exit, is caught, or the tick
+ * limit runs out.
+ * @param job Game to play
+ * @return How the game ended
+ */
+BatchResult BatchRunner::playJob(const BatchJob& job) const {
+    Game game(job.width, job.height, job.seed, job.level, job.algorithm);
+    game.setEnemyBehavior(job.behavior);
+
+    // The player's own stream, so policies never disturb enemy or level randomness
+    Random playerRandom(Random::deriveSeed(job.seed, RandomStream::Player,
+                                           static_cast<uint64_t>(job.level)));
+
+    uint32_t ticks = 0;
+    while (ticks < job.maxTicks && game.isGameRunning() && !game.isLevelWon()) {
+        game.step(policy(game, playerRandom));
+        ticks++;
+    }
+
+    BatchResult result;
+    result.seed = job.seed;
+    result.level = job.level;
+    result.won = game.isLevelWon();
+    result.lost = game.isGameOver();
+    result.ticks = ticks;
+    result.score = game.getPlayer().getScore();
+    result.moves = game.getPlayer().getMoveCount();
+    return result;
+}
+
+/**
+ * Add a result into the summary for its key
+ * @param totals Summaries by key
+ * @param key Level number or seed
+ * @param result Result to add
+ */
+static void addToSummary(std::map<uint64_t, BatchSummary>& totals, uint64_t key, const BatchResult& result) {
+    std::map<uint64_t, BatchSummary>::iterator it = totals.find(key);
+    if (it == totals.end()) {
+        const BatchSummary empty = {key, 0, 0, 0, 0, 0, 0};
+        it = totals.insert(std::make_pair(key, empty)).first;
+    }
+
+    BatchSummary& summary = it->second;
+    summary.games++;
+    if (result.won) {
+        summary.wins++;
+    } else if (result.lost) {
+        summary.losses++;
+    } else {
+        summary.timeouts++;
+    }
+    summary.totalTicks += result.ticks;
+    summary.totalScore += result.score;
+}
+
+/**
+ * Copy summaries out in key order
+ * @param totals Summaries by key
+ * @param summaries Receives the summaries
+ */
+static void collectSummaries(const std::map<uint64_t, BatchSummary>& totals, std::vector<BatchSummary>& summaries) {
+    summaries.clear();
+    summaries.reserve(totals.size());
+    for (std::map<uint64_t, BatchSummary>::const_iterator it = totals.begin(); it != totals.end(); ++it) {
+        summaries.push_back(it->second);
+    }
+}
+
+/**
+ * Total up results per level
+ * @param results Results from run
+ * @param summaries Receives one summary per level, in level order
+ */
+void BatchRunner::summarizeByLevel(const std::vector<BatchResult>& results, std::vector<BatchSummary>& summaries) {
+    std::map<uint64_t, BatchSummary> totals;
+    for (size_t i = 0; i < results.size(); i++) {
+        addToSummary(totals, static_cast<uint64_t>(results[i].level), results[i]);
+    }
+    collectSummaries(totals, summaries);
+}
+
+/**
+ * Total up results per seed
+ * @param results Results from run
+ * @param summaries Receives one summary per seed, in seed order
+ */
+void BatchRunner::summarizeBySeed(const std::vector<BatchResult>& results, std::vector<BatchSummary>& summaries) {
+    std::map<uint64_t, BatchSummary> totals;
+    for (size_t i = 0; i < results.size(); i++) {
+        addToSummary(totals, results[i].seed, results[i]);
+    }
+    collectSummaries(totals, summaries);
+}
+
+/**
+ * Player that moves in a random direction every tick
+ * @param game Game being played
+ * @param random Player's random stream
+ * @return Move to make
+ */
+InputAction BatchRunner::randomPolicy(const Game& game, Random& random) {
+    (void)game;
+    static const InputAction moves[4] = {
+        InputAction::MoveUp, InputAction::MoveRight, InputAction::MoveDown, InputAction::MoveLeft
+    };
+    return moves[random.below(4)];
+}
+
+/**
+ * Player that heads for the exit
+ * Usually takes an open step that brings it closer to the exit, but makes
+ * a random open move one time in four (and whenever no step gets closer),
+ * which gets it around most walls without any search.
+ * @param game Game being played
+ * @param random Player's random stream
+ * @return Move to make
+ */
+InputAction BatchRunner::seekExitPolicy(const Game& game, Random& random) {
+    static const InputAction moves[4] = {
+        InputAction::MoveUp, InputAction::MoveRight, InputAction::MoveDown, InputAction::MoveLeft
+    };
+    static const int directionX[4] = {0, 1, 0, -1};
+    static const int directionY[4] = {-1, 0, 1, 0};
+
+    const MazeView maze = game.getMaze().view();
+    const int x = game.getPlayer().getX();
+    const int y = game.getPlayer().getY();
+    int exitX, exitY;
+    game.getMaze().getExitPosition(exitX, exitY);
+
+    int closer[4], closerCount = 0;
+    int open[4], openCount = 0;
+    for (int d = 0; d < 4; d++) {
+        const int nextX = x + directionX[d];
+        const int nextY = y + directionY[d];
+        if (!maze.isOpen(nextX, nextY)) {
+            continue;
+        }
+        open[openCount++] = d;
+        if (std::abs(exitX - nextX) + std::abs(exitY - nextY) < std::abs(exitX - x) + std::abs(exitY - y)) {
+            closer[closerCount++] = d;
+        }
+    }
+
+    if (openCount == 0) {
+        return InputAction::None;
+    }
+    if (closerCount > 0 && random.below(4) != 0) {
+        return moves[closer[random.below(closerCount)]];
+    }
+    return moves[open[random.below(openCount)]];
+}
@@ -0,0 +1,103 @@
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include "Game.h"
+#include <vector>
+#include <cstdint>
+#include <mutex>
+
+/**
+ * Chooses the simulated player's action for the next tick
+ * Called on a worker thread; must only use the game and random stream given
+ */
+typedef InputAction (*PlayerPolicy)(const Game& game, Random& random);
+
+/**
+ * One game for the batch runner to play: a level of a seeded game
+ */
+struct BatchJob {
+    uint64_t seed;
+    int level;
+    int width, height;          // Maze size in cells
+    MazeAlgorithm algorithm;
+    EnemyBehavior behavior;
+    uint32_t maxTicks;          // Give up (timeout) after this many ticks
+};
+
+/**
+ * How one batch game ended
+ */
+struct BatchResult {
+    uint64_t seed;
+    int level;
+    bool won;                   // Player reached the exit
+    bool lost;                  // Player was caught
+    uint32_t ticks;             // Ticks played (maxTicks on a timeout)
+    int score;
+    int moves;
+};
+
+/**
+ * Results of many batch games added up for one level or one seed
+ */
+struct BatchSummary {
+    uint64_t key;               // Level number or seed
+    int games;
+    int wins;
+    int losses;
+    int timeouts;
+    uint64_t totalTicks;
+    int64_t totalScore;
+};
+
+/**
+ * BatchRunner class playing large numbers of independent games across
+ * all cores
+ * Every job is a self-contained Game with its own seed and its own player
+ * random stream, so results do not depend on the thread count or on which
+ * thread played which game. Work is shared out by stealing: each worker
+ * starts with an equal slice of the job list and plays from the front of
+ * it; a worker that runs out takes the back half of another worker's
+ * remaining slice, so long games do not leave other cores idle.
+ */
+class BatchRunner {
+private:
+    /**
+     * Job indices a worker still has to play, [begin, end)
+     * Padded to a cache line so workers do not contend on each other's counters
+     */
+    struct WorkRange {
+        std::mutex mutex;
+        size_t begin;
+        size_t end;
+        char padding[64];
+    };
+
+    int threadCount;
+    PlayerPolicy policy;
+
+    bool takeJob(std::vector<WorkRange>& ranges, int worker, size_t& job) const;
+    void workerLoop(const std::vector<BatchJob>& jobs, std::vector<BatchResult>& results,
+                    std::vector<WorkRange>& ranges, int worker) const;
+
+public:
+    // Constructor
+    explicit BatchRunner(int threads = 0, PlayerPolicy playerPolicy = &BatchRunner::seekExitPolicy);
+
+    // Running
+    void run(const std::vector<BatchJob>& jobs, std::vector<BatchResult>& results) const;
+    BatchResult playJob(const BatchJob& job) const;
+
+    // Aggregation
+    static void summarizeByLevel(const std::vector<BatchResult>& results, std::vector<BatchSummary>& summaries);
+    static void summarizeBySeed(const std::vector<BatchResult>& results, std::vector<BatchSummary>& summaries);
+
+    // Built-in player policies
+    static InputAction randomPolicy(const Game& game, Random& random);
+    static InputAction seekExitPolicy(const Game& game, Random& random);
+
+    // Getters
+    int getThreadCount() const { return threadCount; }
+};
+
+#endif // BATCHRUNNER_H
@@ -0,0 +1,66 @@
+#include "Camera.h"
+#include <algorithm>
+
+/**
+ * Constructor for Camera class
+ * @param cellsWide Viewport width in maze cells
+ * @param cellsHigh Viewport height in maze cells
+ */
+Camera::Camera(int cellsWide, int cellsHigh)
+    : viewportWidth(1), viewportHeight(1), left(0), top(0), width(0), height(0) {
+    setViewport(cellsWide, cellsHigh);
+}
+
+/**
+ * Set how many maze cells fit on screen
+ * Takes effect on the next follow
+ * @param cellsWide Viewport width in maze cells
+ * @param cellsHigh Viewport height in maze cells
+ */
+void Camera::setViewport(int cellsWide, int cellsHigh) {
+    viewportWidth = std::max(1, cellsWide);
+    viewportHeight = std::max(1, cellsHigh);
+}
+
+/**
+ * Size the viewport to a terminal
+ * Every maze cell takes two columns (the cell and a space)
+ * @param columns Terminal width in characters
+ * @param rows Terminal height in lines
+ * @param reservedRows Lines kept free below the maze for status text
+ */
+void Camera::fitTerminal(int columns, int rows, int reservedRows) {
+    setViewport(columns / 2, rows - reservedRows);
+}
+
+/**
+ * Move the window so the target stays inside it, away from the edges
+ * @param targetX Target X coordinate
+ * @param targetY Target Y coordinate
+ * @param worldWidth Maze width in cells
+ * @param worldHeight Maze height in cells
+ */
+void Camera::follow(int targetX, int targetY, int worldWidth, int worldHeight) {
+    width = std::min(viewportWidth, worldWidth);
+    height = std::min(viewportHeight, worldHeight);
+    left = followAxis(targetX, left, width, worldWidth);
+    top = followAxis(targetY, top, height, worldHeight);
+}
+
+/**
+ * Follow the target along one axis
+ * @param target Target coordinate
+ * @param start Current first visible coordinate
+ * @param visible Visible cells along the axis
+ * @param worldSize Maze cells along the axis
+ * @return New first visible coordinate
+ */
+int Camera::followAxis(int target, int start, int visible, int worldSize) {
+    const int margin = visible / 4;
+    if (target < start + margin) {
+        start = target - margin;
+    } else if (target > start + visible - 1 - margin) {
+        start = target - (visible - 1 - margin);
+    }
+    return std::max(0, std::min(start, worldSize - visible));
+}
@@ -0,0 +1,41 @@
+#ifndef CAMERA_H
+#define CAMERA_H
+
+/**
+ * Camera class choosing which window of the maze is shown
+ * Follows a target (the player) with a margin: the window only scrolls
+ * when the target comes within a quarter of the window of an edge, so
+ * most moves leave the view still and the differential renderer sends
+ * just the cells that changed. The window never extends past the maze,
+ * and shrinks to the maze when the maze is smaller than the viewport.
+ */
+class Camera {
+private:
+    int viewportWidth, viewportHeight; // Cells that fit on screen
+    int left, top;                     // Maze cell shown in the top-left corner
+    int width, height;                 // Visible window, viewport clipped to the maze
+
+    static int followAxis(int target, int start, int visible, int worldSize);
+
+public:
+    // Constructor
+    Camera(int cellsWide = 40, int cellsHigh = 18);
+
+    // Destructor
+    ~Camera() = default;
+
+    // Viewport
+    void setViewport(int cellsWide, int cellsHigh);
+    void fitTerminal(int columns, int rows, int reservedRows);
+    void follow(int targetX, int targetY, int worldWidth, int worldHeight);
+
+    // Getters
+    int getLeft() const { return left; }
+    int getTop() const { return top; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getViewportWidth() const { return viewportWidth; }
+    int getViewportHeight() const { return viewportHeight; }
+};
+
+#endif // CAMERA_H
@@ -0,0 +1,623 @@
+#include "ChunkedWorld.h"
+#include "Maze.h"
+#include "Random.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+
+const int ChunkedWorld::CHUNK_SIZE;
+const int ChunkedWorld::CHUNK_CELLS;
+const int ChunkedWorld::DEFAULT_CACHE_CHUNKS;
+const int ChunkedWorld::ACTIVE_RADIUS;
+const int ChunkedWorld::PREFETCH_DISTANCE;
+const uint64_t ChunkedWorld::NO_CHUNK;
+
+/**
+ * Constructor for ChunkedWorld class
+ * The world is empty until a file is opened
+ */
+ChunkedWorld::ChunkedWorld()
+    : width(0), height(0), exitX(0), exitY(0), chunksX(0), chunksY(0),
+      newestSlot(-1), oldestSlot(-1), slotTableMask(0), loadedChunks(0),
+      recentChunk(NO_CHUNK), recentSlot(-1), chunkLoads(0), chunkEvictions(0),
+      entities(nullptr), activeChunkX(-1), activeChunkY(-1), prefetchDeltaX(0), prefetchDeltaY(0),
+      parkedEnemyCount(0), parkedCollectibleCount(0) {
+}
+
+/**
+ * Write a world file chunk by chunk
+ * Only one chunk is held in memory at a time, so worlds far larger than
+ * memory can be written
+ * @param filename File to write
+ * @param header Header to write (chunk counts and sizes filled in)
+ * @param fillChunk Called as fillChunk(chunkX, chunkY, cells) to fill each chunk
+ * @return true if successful
+ */
+template <typename ChunkFiller>
+static bool writeChunks(const std::string& filename, const ChunkedWorldHeader& header, ChunkFiller fillChunk) {
+    std::ofstream file(filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cout << "Could not write world " << filename << std::endl;
+        return false;
+    }
+
+    std::vector<char> block(CHUNKED_WORLD_DATA_OFFSET, 0);
+    std::memcpy(block.data(), &header, sizeof(header));
+    file.write(block.data(), static_cast<std::streamsize>(block.size()));
+
+    block.resize(ChunkedWorld::CHUNK_CELLS);
+    for (int chunkY = 0; chunkY < header.chunksY && file.good(); chunkY++) {
+        for (int chunkX = 0; chunkX < header.chunksX; chunkX++) {
+            fillChunk(chunkX, chunkY, block.data());
+            file.write(block.data(), static_cast<std::streamsize>(block.size()));
+        }
+    }
+    return file.good();
+}
+
+/**
+ * Fill in the fixed fields of a world header
+ * @param worldWidth World width in cells
+ * @param worldHeight World height in cells
+ * @param seed Generation seed (0 if converted)
+ * @return Header with the exit in the bottom-right corner
+ */
+static ChunkedWorldHeader makeHeader(int worldWidth, int worldHeight, uint64_t seed) {
+    ChunkedWorldHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, CHUNKED_WORLD_MAGIC, sizeof(header.magic));
+    header.version = CHUNKED_WORLD_FORMAT_VERSION;
+    header.headerSize = sizeof(ChunkedWorldHeader);
+    header.chunkSize = ChunkedWorld::CHUNK_SIZE;
+    header.width = worldWidth;
+    header.height = worldHeight;
+    header.exitX = worldWidth - 2;
+    header.exitY = worldHeight - 2;
+    header.chunksX = (worldWidth + ChunkedWorld::CHUNK_SIZE - 1) / ChunkedWorld::CHUNK_SIZE;
+    header.chunksY = (worldHeight + ChunkedWorld::CHUNK_SIZE - 1) / ChunkedWorld::CHUNK_SIZE;
+    header.seed = seed;
+    return header;
+}
+
+/**
+ * Generate a world file with scattered walls, without building it in memory
+ * Each chunk draws from its own random stream, so chunks can be produced
+ * in any order and the same seed always gives the same world. The wall
+ * share rises with the level like Maze's scattered walls.
+ *
+ * Independently scattered walls do not keep a world connected (at 40%
+ * walls the exit alone is boxed in about one time in six), and a repair
+ * pass over the whole world would need all of it in memory. Instead a
+ * lattice of corridors is kept open: every row and column one cell in
+ * from a chunk edge, plus the last row and column inside the border.
+ * Whether a cell is a corridor depends only on its coordinates, so each
+ * chunk is still generated alone, and the start (1,1) and the exit
+ * (width-2, height-2) both lie on the lattice and are always connected.
+ * Open cells off the lattice may still form closed pockets.
+ * @param filename File to write
+ * @param worldWidth World width in cells (at least 4)
+ * @param worldHeight World height in cells (at least 4)
+ * @param level Level number, for the wall density
+ * @param seed World seed
+ * @return true if successful
+ */
+bool ChunkedWorld::generateFile(const std::string& filename, int worldWidth, int worldHeight,
+                                int level, uint64_t seed) {
+    if (worldWidth < 4 || worldHeight < 4) {
+        std::cout << "World size " << worldWidth << "x" << worldHeight << " is too small!" << std::endl;
+        return false;
+    }
+
+    const ChunkedWorldHeader header = makeHeader(worldWidth, worldHeight, seed);
+    const int wallPercent = std::min(10 + level * 5, 40);
+
+    return writeChunks(filename, header, [&](int chunkX, int chunkY, char* cells) {
+        const uint64_t chunk = static_cast<uint64_t>(chunkY) * header.chunksX + chunkX;
+        Random random(Random::deriveSeed(seed, RandomStream::Generation, chunk));
+        for (int row = 0; row < CHUNK_SIZE; row++) {
+            const int y = chunkY * CHUNK_SIZE + row;
+            for (int column = 0; column < CHUNK_SIZE; column++) {
+                const int x = chunkX * CHUNK_SIZE + column;
+                char cell;
+                if (x >= worldWidth - 1 || y >= worldHeight - 1 || x == 0 || y == 0) {
+                    cell = '#'; // Border, and the padding of edge chunks
+                } else if (x == header.exitX && y == header.exitY) {
+                    cell = 'E';
+                } else if (column == 1 || row == 1 || x == worldWidth - 2 || y == worldHeight - 2) {
+                    cell = ' '; // Corridor lattice, which includes the start
+                } else {
+                    cell = random.below(100) < wallPercent ? '#' : ' ';
+                }
+                cells[row * CHUNK_SIZE + column] = cell;
+            }
+        }
+    });
+}
+
+/**
+ * Write an existing maze as a world file
+ * @param filename File to write
+ * @param maze Maze to convert
+ * @return true if successful
+ */
+bool ChunkedWorld::writeFile(const std::string& filename, const Maze& maze) {
+    ChunkedWorldHeader header = makeHeader(maze.getWidth(), maze.getHeight(), 0);
+    maze.getExitPosition(header.exitX, header.exitY);
+
+    return writeChunks(filename, header, [&](int chunkX, int chunkY, char* cells) {
+        for (int row = 0; row < CHUNK_SIZE; row++) {
+            for (int column = 0; column < CHUNK_SIZE; column++) {
+                cells[row * CHUNK_SIZE + column] =
+                    maze.getCell(chunkX * CHUNK_SIZE + column, chunkY * CHUNK_SIZE + row);
+            }
+        }
+    });
+}
+
+/**
+ * Open a world file for streaming
+ * Only the header is read; chunks are read when first needed. Parked
+ * entities of a previously open world are dropped.
+ * @param filename File to open
+ * @param cacheChunks Chunks to keep in memory (at least the live area)
+ * @return true if successful
+ */
+bool ChunkedWorld::open(const std::string& filename, int cacheChunks) {
+    close();
+
+    if (!file.open(filename, false)) {
+        std::cout << "Could not open world " << filename << std::endl;
+        return false;
+    }
+
+    ChunkedWorldHeader header;
+    if (file.size() < CHUNKED_WORLD_DATA_OFFSET) {
+        std::cout << "World " << filename << " is too short!" << std::endl;
+        file.close();
+        return false;
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    const bool valid = std::memcmp(header.magic, CHUNKED_WORLD_MAGIC, sizeof(header.magic)) == 0 &&
+                       header.version == CHUNKED_WORLD_FORMAT_VERSION &&
+                       header.headerSize == sizeof(ChunkedWorldHeader) &&
+                       header.chunkSize == static_cast<uint32_t>(CHUNK_SIZE) &&
+                       header.width >= 4 && header.height >= 4 &&
+                       header.chunksX == (header.width + CHUNK_SIZE - 1) / CHUNK_SIZE &&
+                       header.chunksY == (header.height + CHUNK_SIZE - 1) / CHUNK_SIZE &&
+                       header.exitX >= 0 && header.exitX < header.width &&
+                       header.exitY >= 0 && header.exitY < header.height;
+    if (!valid) {
+        std::cout << "World " << filename << " is not a valid world file!" << std::endl;
+        file.close();
+        return false;
+    }
+
+    const uint64_t chunkCount = static_cast<uint64_t>(header.chunksX) * static_cast<uint64_t>(header.chunksY);
+    if ((file.size() - CHUNKED_WORLD_DATA_OFFSET) / CHUNK_CELLS < chunkCount) {
+        std::cout << "World " << filename << " is truncated!" << std::endl;
+        file.close();
+        return false;
+    }
+
+    width = header.width;
+    height = header.height;
+    exitX = header.exitX;
+    exitY = header.exitY;
+    chunksX = header.chunksX;
+    chunksY = header.chunksY;
+
+    const int liveChunks = (2 * ACTIVE_RADIUS + 1) * (2 * ACTIVE_RADIUS + 1);
+    const int slots = std::max(cacheChunks, liveChunks);
+    slotCells.assign(static_cast<size_t>(slots) * CHUNK_CELLS, '#');
+    slotChunk.assign(slots, NO_CHUNK);
+
+    // Every slot starts free, in one list from newest to oldest
+    slotNewer.resize(slots);
+    slotOlder.resize(slots);
+    for (int i = 0; i < slots; i++) {
+        slotNewer[i] = i - 1;
+        slotOlder[i] = i + 1 < slots ? i + 1 : -1;
+    }
+    newestSlot = 0;
+    oldestSlot = slots - 1;
+
+    // At most half full, so probe runs stay short
+    size_t tableSize = 1;
+    while (tableSize < static_cast<size_t>(slots) * 2) {
+        tableSize *= 2;
+    }
+    slotTable.assign(tableSize, -1);
+    slotTableMask = tableSize - 1;
+    return true;
+}
+
+/**
+ * Close the world file and drop every cached chunk and parked entity
+ */
+void ChunkedWorld::close() {
+    file.close();
+    width = height = 0;
+    exitX = exitY = 0;
+    chunksX = chunksY = 0;
+    std::vector<char>().swap(slotCells);
+    slotChunk.clear();
+    slotNewer.clear();
+    slotOlder.clear();
+    newestSlot = oldestSlot = -1;
+    slotTable.clear();
+    slotTableMask = 0;
+    loadedChunks = 0;
+    recentChunk = NO_CHUNK;
+    recentSlot = -1;
+    chunkLoads = chunkEvictions = 0;
+    parked.clear();
+    parkedEnemyCount = parkedCollectibleCount = 0;
+    activeChunkX = activeChunkY = -1;
+    prefetchDeltaX = prefetchDeltaY = 0;
+}
+
+/**
+ * Get cell value at specified position
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @return Character at position ('#' outside the world)
+ */
+char ChunkedWorld::getCell(int x, int y) const {
+    if (!isValidPosition(x, y)) {
+        return '#';
+    }
+    const int slot = slotFor(chunkIndex(x / CHUNK_SIZE, y / CHUNK_SIZE));
+    return slotCells[static_cast<size_t>(slot) * CHUNK_CELLS + (y % CHUNK_SIZE) * CHUNK_SIZE + x % CHUNK_SIZE];
+}
+
+/**
+ * Look up the cache slot holding a chunk
+ * @param chunk Chunk index
+ * @return Slot holding the chunk, or -1 if it is not loaded
+ */
+int ChunkedWorld::findSlot(uint64_t chunk) const {
+    for (size_t i = tablePosition(chunk); slotTable[i] >= 0; i = (i + 1) & slotTableMask) {
+        if (slotChunk[slotTable[i]] == chunk) {
+            return slotTable[i];
+        }
+    }
+    return -1;
+}
+
+/**
+ * Record which slot a chunk was loaded into
+ * @param chunk Chunk index (not already in the table)
+ * @param slot Slot holding it
+ */
+void ChunkedWorld::indexSlot(uint64_t chunk, int slot) const {
+    size_t i = tablePosition(chunk);
+    while (slotTable[i] >= 0) {
+        i = (i + 1) & slotTableMask;
+    }
+    slotTable[i] = slot;
+}
+
+/**
+ * Forget the slot of a chunk that is being evicted
+ * Later entries of the probe run are shifted back over the gap, so lookups
+ * never need tombstones
+ * @param chunk Chunk index (must be in the table, its slot still holding it)
+ */
+void ChunkedWorld::unindexSlot(uint64_t chunk) const {
+    size_t gap = tablePosition(chunk);
+    while (slotChunk[slotTable[gap]] != chunk) {
+        gap = (gap + 1) & slotTableMask;
+    }
+
+    for (size_t i = (gap + 1) & slotTableMask; slotTable[i] >= 0; i = (i + 1) & slotTableMask) {
+        // An entry may fill the gap only if its home position is not between the gap and itself
+        const size_t home = tablePosition(slotChunk[slotTable[i]]);
+        if (((i - home) & slotTableMask) >= ((i - gap) & slotTableMask)) {
+            slotTable[gap] = slotTable[i];
+            gap = i;
+        }
+    }
+    slotTable[gap] = -1;
+}
+
+/**
+ * Move a slot to the front of the use order
+ * @param slot Slot just used
+ */
+void ChunkedWorld::markUsed(int slot) const {
+    if (slot == newestSlot) {
+        return;
+    }
+
+    // Unlink (the slot is not the newest, so it has a newer neighbour)
+    slotOlder[slotNewer[slot]] = slotOlder[slot];
+    if (slotOlder[slot] >= 0) {
+        slotNewer[slotOlder[slot]] = slotNewer[slot];
+    } else {
+        oldestSlot = slotNewer[slot];
+    }
+
+    slotNewer[slot] = -1;
+    slotOlder[slot] = newestSlot;
+    slotNewer[newestSlot] = slot;
+    newestSlot = slot;
+}
+
+/**
+ * Find the cache slot holding a chunk, loading it if needed
+ * Repeated lookups in one chunk skip the table lookup
+ * @param chunk Chunk index
+ * @return Slot holding the chunk
+ */
+int ChunkedWorld::slotFor(uint64_t chunk) const {
+    if (chunk != recentChunk) {
+        const int slot = findSlot(chunk);
+        recentSlot = slot >= 0 ? slot : loadChunk(chunk);
+        recentChunk = chunk;
+        markUsed(recentSlot);
+    }
+    return recentSlot;
+}
+
+/**
+ * Copy a chunk from the file into the least recently used slot
+ * Free slots are always the least recently used. The evicted chunk's
+ * pages are handed back to the system.
+ * @param chunk Chunk index
+ * @return Slot now holding the chunk
+ */
+int ChunkedWorld::loadChunk(uint64_t chunk) const {
+    const int slot = oldestSlot;
+    if (slotChunk[slot] != NO_CHUNK) {
+        unindexSlot(slotChunk[slot]);
+        file.release(chunkOffset(slotChunk[slot]), CHUNK_CELLS);
+        chunkEvictions++;
+    } else {
+        loadedChunks++;
+    }
+
+    std::memcpy(&slotCells[static_cast<size_t>(slot) * CHUNK_CELLS], file.data() + chunkOffset(chunk), CHUNK_CELLS);
+    slotChunk[slot] = chunk;
+    indexSlot(chunk, slot);
+    chunkLoads++;
+    return slot;
+}
+
+/**
+ * Check whether a chunk is inside the live area around the player
+ * @param chunkX Chunk column
+ * @param chunkY Chunk row
+ * @return true if its entities should be live
+ */
+bool ChunkedWorld::isActiveChunk(int chunkX, int chunkY) const {
+    return activeChunkX >= 0 &&
+           std::abs(chunkX - activeChunkX) <= ACTIVE_RADIUS &&
+           std::abs(chunkY - activeChunkY) <= ACTIVE_RADIUS;
+}
+
+/**
+ * Follow the player: keep the chunks around them loaded and their entities live
+ * Call once per tick. Only does real work when the player enters another
+ * chunk or changes direction.
+ * @param playerX Player X coordinate
+ * @param playerY Player Y coordinate
+ * @param deltaX Player's last horizontal step (-1, 0 or 1)
+ * @param deltaY Player's last vertical step (-1, 0 or 1)
+ */
+void ChunkedWorld::update(int playerX, int playerY, int deltaX, int deltaY) {
+    if (!isOpen() || !isValidPosition(playerX, playerY)) {
+        return;
+    }
+
+    const int chunkX = playerX / CHUNK_SIZE;
+    const int chunkY = playerY / CHUNK_SIZE;
+    const bool moved = chunkX != activeChunkX || chunkY != activeChunkY;
+    if (moved) {
+        const int oldChunkX = activeChunkX;
+        const int oldChunkY = activeChunkY;
+        activeChunkX = chunkX;
+        activeChunkY = chunkY;
+        parkOutOfRange();
+
+        for (int y = chunkY - ACTIVE_RADIUS; y <= chunkY + ACTIVE_RADIUS; y++) {
+            for (int x = chunkX - ACTIVE_RADIUS; x <= chunkX + ACTIVE_RADIUS; x++) {
+                if (x < 0 || y < 0 || x >= chunksX || y >= chunksY) {
+                    continue;
+                }
+                slotFor(chunkIndex(x, y)); // Load now rather than on the first cell read
+                const bool wasActive = oldChunkX >= 0 &&
+                                       std::abs(x - oldChunkX) <= ACTIVE_RADIUS &&
+                                       std::abs(y - oldChunkY) <= ACTIVE_RADIUS;
+                if (!wasActive) {
+                    restoreChunk(x, y);
+                }
+            }
+        }
+        prefetchAround();
+    }
+
+    if ((deltaX != 0 || deltaY != 0) &&
+        (moved || deltaX != prefetchDeltaX || deltaY != prefetchDeltaY)) {
+        prefetchAhead(deltaX, deltaY);
+        prefetchDeltaX = deltaX;
+        prefetchDeltaY = deltaY;
+    }
+}
+
+/**
+ * Ask the system to start reading a chunk that is not loaded yet
+ * @param chunkX Chunk column (may be outside the world)
+ * @param chunkY Chunk row (may be outside the world)
+ */
+void ChunkedWorld::prefetchChunk(int chunkX, int chunkY) const {
+    if (chunkX < 0 || chunkY < 0 || chunkX >= chunksX || chunkY >= chunksY) {
+        return;
+    }
+    const uint64_t chunk = chunkIndex(chunkX, chunkY);
+    if (findSlot(chunk) < 0) {
+        file.prefetch(chunkOffset(chunk), CHUNK_CELLS);
+    }
+}
+
+/**
+ * Ask the system to start reading the ring of chunks just outside the live area
+ * Whichever neighbouring chunk the player enters next, the chunks that
+ * update then loads are all in this ring, so none of them has to wait
+ * for the disk on the tick
+ */
+void ChunkedWorld::prefetchAround() const {
+    const int reach = ACTIVE_RADIUS + 1;
+    for (int side = -reach; side <= reach; side++) {
+        prefetchChunk(activeChunkX + side, activeChunkY - reach);
+        prefetchChunk(activeChunkX + side, activeChunkY + reach);
+    }
+    for (int side = -ACTIVE_RADIUS; side <= ACTIVE_RADIUS; side++) {
+        prefetchChunk(activeChunkX - reach, activeChunkY + side);
+        prefetchChunk(activeChunkX + reach, activeChunkY + side);
+    }
+}
+
+/**
+ * Ask the system to start reading the chunks the player is heading for
+ * Covers PREFETCH_DISTANCE rows or columns of chunks beyond the live area
+ * @param deltaX Horizontal direction of movement
+ * @param deltaY Vertical direction of movement
+ */
+void ChunkedWorld::prefetchAhead(int deltaX, int deltaY) const {
+    for (int distance = 1; distance <= PREFETCH_DISTANCE; distance++) {
+        const int reach = ACTIVE_RADIUS + distance;
+        for (int side = -ACTIVE_RADIUS; side <= ACTIVE_RADIUS; side++) {
+            prefetchChunk(deltaX != 0 ? activeChunkX + deltaX * reach : activeChunkX + side,
+                          deltaX != 0 ? activeChunkY + side : activeChunkY + deltaY * reach);
+        }
+    }
+}
+
+/**
+ * Move live entities that are outside the live area into their chunk's records
+ * Collected items and inactive enemies are dropped rather than parked
+ */
+void ChunkedWorld::parkOutOfRange() {
+    if (entities == nullptr) {
+        return;
+    }
+
+    // Walk backwards so the swap-remove only moves entities already checked
+    EnemyColumns& enemy = entities->enemies();
+    for (int i = entities->getEnemyCount() - 1; i >= 0; i--) {
+        const int chunkX = enemy.x[i] / CHUNK_SIZE;
+        const int chunkY = enemy.y[i] / CHUNK_SIZE;
+        if (enemy.active[i] && isActiveChunk(chunkX, chunkY)) {
+            continue;
+        }
+        if (enemy.active[i]) {
+            const ParkedEnemy record = {enemy.x[i], enemy.y[i], enemy.moveTimer[i], enemy.moveDelay[i]};
+            parked[chunkIndex(chunkX, chunkY)].enemies.push_back(record);
+            parkedEnemyCount++;
+        }
+        entities->removeEnemy(i);
+    }
+
+    CollectibleColumns& collectible = entities->collectibles();
+    for (int i = entities->getCollectibleCount() - 1; i >= 0; i--) {
+        const int chunkX = collectible.x[i] / CHUNK_SIZE;
+        const int chunkY = collectible.y[i] / CHUNK_SIZE;
+        if (!collectible.collected[i] && isActiveChunk(chunkX, chunkY)) {
+            continue;
+        }
+        if (!collectible.collected[i]) {
+            const ParkedCollectible record = {collectible.x[i], collectible.y[i], collectible.pointValue[i]};
+            parked[chunkIndex(chunkX, chunkY)].collectibles.push_back(record);
+            parkedCollectibleCount++;
+        }
+        entities->removeCollectible(i);
+    }
+}
+
+/**
+ * Bring a chunk's parked entities back into the live store
+ * @param chunkX Chunk column
+ * @param chunkY Chunk row
+ */
+void ChunkedWorld::restoreChunk(int chunkX, int chunkY) {
+    if (entities == nullptr) {
+        return;
+    }
+    std::unordered_map<uint64_t, ParkedChunk>::iterator it = parked.find(chunkIndex(chunkX, chunkY));
+    if (it == parked.end()) {
+        return;
+    }
+
+    ParkedChunk& records = it->second;
+    for (size_t i = 0; i < records.enemies.size(); i++) {
+        const ParkedEnemy& record = records.enemies[i];
+        const int index = entities->addEnemy(record.x, record.y, record.moveDelay);
+        entities->enemies().moveTimer[index] = record.moveTimer;
+    }
+    for (size_t i = 0; i < records.collectibles.size(); i++) {
+        const ParkedCollectible& record = records.collectibles[i];
+        entities->addCollectible(record.x, record.y, record.pointValue);
+    }
+    parkedEnemyCount -= records.enemies.size();
+    parkedCollectibleCount -= records.collectibles.size();
+
+    // Keep the emptied record, so parking here again reuses its storage
+    records.enemies.clear();
+    records.collectibles.clear();
+}
+
+/**
+ * Use a store for the live entities
+ * Entities already in the store are sorted into live and parked on the
+ * next update
+ * @param store Store to use (null to keep every entity parked)
+ */
+void ChunkedWorld::attachEntities(EntityStore* store) {
+    entities = store;
+    activeChunkX = activeChunkY = -1; // Re-sort everything on the next update
+}
+
+/**
+ * Add an enemy anywhere in the world
+ * It goes straight into the live store if it is near the player,
+ * otherwise it waits parked in its chunk
+ * @param x X position
+ * @param y Y position
+ * @param delay Movement delay
+ */
+void ChunkedWorld::addEnemy(int x, int y, int delay) {
+    if (!isValidPosition(x, y)) {
+        return;
+    }
+    if (entities != nullptr && isActiveChunk(x / CHUNK_SIZE, y / CHUNK_SIZE)) {
+        entities->addEnemy(x, y, delay);
+        return;
+    }
+    const ParkedEnemy record = {x, y, 0, delay};
+    parked[chunkIndex(x / CHUNK_SIZE, y / CHUNK_SIZE)].enemies.push_back(record);
+    parkedEnemyCount++;
+}
+
+/**
+ * Add a collectible anywhere in the world
+ * It goes straight into the live store if it is near the player,
+ * otherwise it waits parked in its chunk
+ * @param x X position
+ * @param y Y position
+ * @param points Point value when collected
+ */
+void ChunkedWorld::addCollectible(int x, int y, int points) {
+    if (!isValidPosition(x, y)) {
+        return;
+    }
+    if (entities != nullptr && isActiveChunk(x / CHUNK_SIZE, y / CHUNK_SIZE)) {
+        entities->addCollectible(x, y, points);
+        return;
+    }
+    const ParkedCollectible record = {x, y, points};
+    parked[chunkIndex(x / CHUNK_SIZE, y / CHUNK_SIZE)].collectibles.push_back(record);
+    parkedCollectibleCount++;
+}
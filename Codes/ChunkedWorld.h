@@ -0,0 +1,203 @@
+#ifndef CHUNKEDWORLD_H
+#define CHUNKEDWORLD_H
+
+#include "MappedFile.h"
+#include "EntityStore.h"
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+class Maze;
+
+/**
+ * Chunked world file layout (format version 1)
+ *
+ *   ChunkedWorldHeader             fixed size, see below
+ *   zero padding                   up to CHUNKED_WORLD_DATA_OFFSET
+ *   chunks                         chunksX * chunksY chunks, row by row
+ *
+ * Each chunk is CHUNK_SIZE x CHUNK_SIZE cell characters, row by row, so a
+ * chunk is exactly one 4 KB page and starts on a page boundary. Cells of
+ * edge chunks that lie outside the world are stored as walls. Integers in
+ * the header are stored in the machine's native byte order.
+ */
+
+/**
+ * Fixed header at the start of a chunked world file
+ */
+struct ChunkedWorldHeader {
+    char magic[8];              // CHUNKED_WORLD_MAGIC
+    uint32_t version;           // CHUNKED_WORLD_FORMAT_VERSION
+    uint32_t headerSize;        // sizeof(ChunkedWorldHeader)
+    uint32_t chunkSize;         // Cells along each side of a chunk
+    int32_t width, height;      // World size in cells
+    int32_t exitX, exitY;
+    int32_t chunksX, chunksY;   // Chunks across and down
+    uint32_t reserved;          // Zero
+    uint64_t seed;              // Seed the world was generated from (0 if converted)
+};
+
+static_assert(sizeof(ChunkedWorldHeader) == 56, "ChunkedWorldHeader is copied to and from disk as is");
+
+const char CHUNKED_WORLD_MAGIC[8] = {'M', 'A', 'Z', 'E', 'W', 'L', 'D', '1'};
+const uint32_t CHUNKED_WORLD_FORMAT_VERSION = 1;
+const size_t CHUNKED_WORLD_DATA_OFFSET = 4096;
+
+/**
+ * ChunkedWorld class streaming a maze too large for memory from disk
+ * The world file is mapped without reading it, and cells are copied a
+ * chunk at a time into a fixed number of cache slots; the least recently
+ * used chunk is dropped (and its pages released) when a new one is
+ * needed. getCell, isWall and isExit behave exactly like Maze's.
+ *
+ * update() is called once per tick with the player's position: it keeps
+ * the chunks around the player loaded, asks the system to start reading
+ * every chunk the next chunk crossing could bring into range (and further
+ * ahead in the direction of travel), and keeps entities live only
+ * near the player. Entities in chunks that fall out of range are moved
+ * out of the attached EntityStore into compact per-chunk records and put
+ * back when the player returns, so the per-tick loops only ever see the
+ * entities around the player. Work per update is bounded by the entities
+ * and chunks around the player, never by the size of the world.
+ *
+ * Only the cells are streamed: the parked records stay in memory, so their
+ * size grows with the number of entities in the world rather than the
+ * area around the player. The class is a standalone backend; Game, MazeView
+ * and Pathfinder still use the in-memory Maze.
+ */
+class ChunkedWorld {
+public:
+    static const int CHUNK_SIZE = 64;
+    static const int CHUNK_CELLS = CHUNK_SIZE * CHUNK_SIZE;
+    static const int DEFAULT_CACHE_CHUNKS = 64;
+    static const int ACTIVE_RADIUS = 1;     // Chunks around the player's chunk kept live
+    static const int PREFETCH_DISTANCE = 2; // Chunks ahead of the live area read in advance
+
+private:
+    /**
+     * Enemy waiting in a chunk that is out of range
+     */
+    struct ParkedEnemy {
+        int32_t x, y;
+        int32_t moveTimer;
+        int32_t moveDelay;
+    };
+
+    /**
+     * Uncollected collectible waiting in a chunk that is out of range
+     */
+    struct ParkedCollectible {
+        int32_t x, y;
+        int32_t pointValue;
+    };
+
+    /**
+     * Entities of one out-of-range chunk
+     */
+    struct ParkedChunk {
+        std::vector<ParkedEnemy> enemies;
+        std::vector<ParkedCollectible> collectibles;
+    };
+
+    static const uint64_t NO_CHUNK = ~static_cast<uint64_t>(0);
+
+    MappedFile file;
+    int width, height;
+    int exitX, exitY;
+    int chunksX, chunksY;
+
+    // Chunk cache (filled on demand, so const lookups may load chunks). All of
+    // it is sized by open, so loading and evicting chunks never allocates.
+    mutable std::vector<char> slotCells;             // CHUNK_CELLS characters per slot
+    mutable std::vector<uint64_t> slotChunk;         // Chunk held by each slot, NO_CHUNK if free
+    mutable std::vector<int> slotNewer, slotOlder;   // Slots in order of use, -1 at either end
+    mutable int newestSlot, oldestSlot;
+    mutable std::vector<int> slotTable;              // Open-addressed chunk -> slot index, -1 if empty
+    size_t slotTableMask;                            // Table size minus one (a power of two)
+    mutable size_t loadedChunks;
+    mutable uint64_t recentChunk;                    // Last chunk looked up, and its slot
+    mutable int recentSlot;
+    mutable uint64_t chunkLoads;
+    mutable uint64_t chunkEvictions;
+
+    // Live area and parked entities
+    EntityStore* entities;                           // Live entities (null if none attached)
+    std::unordered_map<uint64_t, ParkedChunk> parked;
+    int activeChunkX, activeChunkY;                  // Centre of the live area, -1 before the first update
+    int prefetchDeltaX, prefetchDeltaY;              // Direction the last prefetch was made for
+    size_t parkedEnemyCount;
+    size_t parkedCollectibleCount;
+
+    uint64_t chunkIndex(int chunkX, int chunkY) const {
+        return static_cast<uint64_t>(chunkY) * static_cast<uint64_t>(chunksX) + static_cast<uint64_t>(chunkX);
+    }
+    size_t chunkOffset(uint64_t chunk) const {
+        return CHUNKED_WORLD_DATA_OFFSET + static_cast<size_t>(chunk) * CHUNK_CELLS;
+    }
+    size_t tablePosition(uint64_t chunk) const {
+        return static_cast<size_t>((chunk * 0x9E3779B97F4A7C15ULL) >> 32) & slotTableMask;
+    }
+    int findSlot(uint64_t chunk) const;
+    void indexSlot(uint64_t chunk, int slot) const;
+    void unindexSlot(uint64_t chunk) const;
+    void markUsed(int slot) const;
+    int slotFor(uint64_t chunk) const;
+    int loadChunk(uint64_t chunk) const;
+    void prefetchChunk(int chunkX, int chunkY) const;
+    void prefetchAround() const;
+    bool isActiveChunk(int chunkX, int chunkY) const;
+    void parkOutOfRange();
+    void restoreChunk(int chunkX, int chunkY);
+    void prefetchAhead(int deltaX, int deltaY) const;
+
+public:
+    // Constructor
+    ChunkedWorld();
+
+    // Destructor
+    ~ChunkedWorld() = default;
+
+    // Not copyable: owns the mapping
+    ChunkedWorld(const ChunkedWorld&) = delete;
+    ChunkedWorld& operator=(const ChunkedWorld&) = delete;
+
+    // World files
+    static bool generateFile(const std::string& filename, int worldWidth, int worldHeight,
+                             int level, uint64_t seed);
+    static bool writeFile(const std::string& filename, const Maze& maze);
+    bool open(const std::string& filename, int cacheChunks = DEFAULT_CACHE_CHUNKS);
+    void close();
+
+    // Grid access (same behaviour as Maze)
+    bool isValidPosition(int x, int y) const {
+        return static_cast<unsigned>(x) < static_cast<unsigned>(width) &&
+               static_cast<unsigned>(y) < static_cast<unsigned>(height);
+    }
+    char getCell(int x, int y) const;
+    bool isWall(int x, int y) const { return getCell(x, y) == '#'; }
+    bool isExit(int x, int y) const { return x == exitX && y == exitY; }
+    void getExitPosition(int& x, int& y) const { x = exitX; y = exitY; }
+
+    // Streaming
+    void update(int playerX, int playerY, int deltaX, int deltaY);
+
+    // Entities
+    void attachEntities(EntityStore* store);
+    void addEnemy(int x, int y, int delay);
+    void addCollectible(int x, int y, int points);
+
+    // Getters
+    bool isOpen() const { return file.isOpen(); }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getCacheChunks() const { return static_cast<int>(slotChunk.size()); }
+    size_t getLoadedChunkCount() const { return loadedChunks; }
+    uint64_t getChunkLoads() const { return chunkLoads; }
+    uint64_t getChunkEvictions() const { return chunkEvictions; }
+    size_t getParkedEnemyCount() const { return parkedEnemyCount; }
+    size_t getParkedCollectibleCount() const { return parkedCollectibleCount; }
+};
+
+#endif // CHUNKEDWORLD_H
@@ -2,7 +2,8 @@
 #define ENTITY_H
 
 /**
- * Base class for all game entities (Player, Enemy, Collectible)
+ * Base class for object-style game entities (the Player)
+ * Enemies and collectibles live column by column in EntityStore instead
  * Provides common functionality for position and display
  */
 class Entity {
@@ -0,0 +1,115 @@
+#include "EntityStore.h"
+#include <utility>
+
+/**
+ * Constructor for EntityStore class
+ */
+EntityStore::EntityStore()
+    : arena(new LevelArena()), enemyData(arena.get()), collectibleData(arena.get()) {
+}
+
+/**
+ * Remove all entities and release their storage in one arena reset
+ */
+void EntityStore::clear() {
+    // Columns must let go of their storage before the arena takes it back
+    enemyData = EnemyColumns(arena.get());
+    collectibleData = CollectibleColumns(arena.get());
+    arena->reset();
+}
+
+/**
+ * Exchange contents with another store (constant time)
+ * Each store's columns keep the arena they were allocated from
+ * @param other Store to swap with
+ */
+void EntityStore::swap(EntityStore& other) {
+    std::swap(arena, other.arena);
+    std::swap(enemyData, other.enemyData);
+    std::swap(collectibleData, other.collectibleData);
+}
+
+/**
+ * Reserve column capacity
+ * @param enemyCount Expected number of enemies
+ * @param collectibleCount Expected number of collectibles
+ */
+void EntityStore::reserve(int enemyCount, int collectibleCount) {
+    enemyData.x.reserve(enemyCount);
+    enemyData.y.reserve(enemyCount);
+    enemyData.moveTimer.reserve(enemyCount);
+    enemyData.moveDelay.reserve(enemyCount);
+    enemyData.active.reserve(enemyCount);
+
+    collectibleData.x.reserve(collectibleCount);
+    collectibleData.y.reserve(collectibleCount);
+    collectibleData.pointValue.reserve(collectibleCount);
+    collectibleData.collected.reserve(collectibleCount);
+}
+
+/**
+ * Add an active enemy
+ * @param x Initial X position
+ * @param y Initial Y position
+ * @param delay Movement delay (higher = slower movement)
+ * @return Index of the new enemy
+ */
+int EntityStore::addEnemy(int x, int y, int delay) {
+    enemyData.x.push_back(x);
+    enemyData.y.push_back(y);
+    enemyData.moveTimer.push_back(0);
+    enemyData.moveDelay.push_back(delay);
+    enemyData.active.push_back(1);
+    return getEnemyCount() - 1;
+}
+
+/**
+ * Add an uncollected collectible
+ * @param x X position
+ * @param y Y position
+ * @param points Point value when collected
+ * @return Index of the new collectible
+ */
+int EntityStore::addCollectible(int x, int y, int points) {
+    collectibleData.x.push_back(x);
+    collectibleData.y.push_back(y);
+    collectibleData.pointValue.push_back(points);
+    collectibleData.collected.push_back(0);
+    return getCollectibleCount() - 1;
+}
+
+/**
+ * Remove an enemy by moving the last enemy into its place
+ * The last enemy's index changes to index; order is not kept
+ * @param index Enemy to remove
+ */
+void EntityStore::removeEnemy(int index) {
+    const int last = getEnemyCount() - 1;
+    enemyData.x[index] = enemyData.x[last];
+    enemyData.y[index] = enemyData.y[last];
+    enemyData.moveTimer[index] = enemyData.moveTimer[last];
+    enemyData.moveDelay[index] = enemyData.moveDelay[last];
+    enemyData.active[index] = enemyData.active[last];
+    enemyData.x.pop_back();
+    enemyData.y.pop_back();
+    enemyData.moveTimer.pop_back();
+    enemyData.moveDelay.pop_back();
+    enemyData.active.pop_back();
+}
+
+/**
+ * Remove a collectible by moving the last collectible into its place
+ * The last collectible's index changes to index; order is not kept
+ * @param index Collectible to remove
+ */
+void EntityStore::removeCollectible(int index) {
+    const int last = getCollectibleCount() - 1;
+    collectibleData.x[index] = collectibleData.x[last];
+    collectibleData.y[index] = collectibleData.y[last];
+    collectibleData.pointValue[index] = collectibleData.pointValue[last];
+    collectibleData.collected[index] = collectibleData.collected[last];
+    collectibleData.x.pop_back();
+    collectibleData.y.pop_back();
+    collectibleData.pointValue.pop_back();
+    collectibleData.collected.pop_back();
+}
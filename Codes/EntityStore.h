@@ -0,0 +1,89 @@
+#ifndef ENTITYSTORE_H
+#define ENTITYSTORE_H
+
+#include "LevelArena.h"
+#include <vector>
+#include <cstdint>
+#include <memory>
+
+/**
+ * Entity column whose storage comes from the store's level arena
+ */
+template <typename T>
+using EntityColumn = std::vector<T, ArenaAllocator<T>>;
+
+/**
+ * Enemy state stored column by column
+ * Entry i of every column describes enemy i
+ */
+struct EnemyColumns {
+    EntityColumn<int32_t> x, y;        // Positions
+    EntityColumn<int32_t> moveTimer;   // Ticks since the last move attempt
+    EntityColumn<int32_t> moveDelay;   // Ticks between move attempts
+    EntityColumn<uint8_t> active;      // Whether the enemy takes part in the game
+
+    explicit EnemyColumns(LevelArena* arena)
+        : x(ArenaAllocator<int32_t>(arena)), y(ArenaAllocator<int32_t>(arena)),
+          moveTimer(ArenaAllocator<int32_t>(arena)), moveDelay(ArenaAllocator<int32_t>(arena)),
+          active(ArenaAllocator<uint8_t>(arena)) {}
+};
+
+/**
+ * Collectible state stored column by column
+ * Entry i of every column describes collectible i
+ */
+struct CollectibleColumns {
+    EntityColumn<int32_t> x, y;        // Positions
+    EntityColumn<int32_t> pointValue;  // Points awarded when collected
+    EntityColumn<uint8_t> collected;   // Whether the item has been collected
+
+    explicit CollectibleColumns(LevelArena* arena)
+        : x(ArenaAllocator<int32_t>(arena)), y(ArenaAllocator<int32_t>(arena)),
+          pointValue(ArenaAllocator<int32_t>(arena)), collected(ArenaAllocator<uint8_t>(arena)) {}
+};
+
+/**
+ * EntityStore class holding all enemies and collectibles of a level
+ * Uses a structure-of-arrays layout so per-tick loops walk contiguous
+ * memory without pointer chasing or virtual calls. Every column is
+ * allocated from one arena owned by the store, so a level's entities sit
+ * together in one block and clearing the store for the next level gives
+ * it all back in one reset.
+ */
+class EntityStore {
+private:
+    std::unique_ptr<LevelArena> arena;  // Storage of every column; swapped along with them
+    EnemyColumns enemyData;
+    CollectibleColumns collectibleData;
+
+public:
+    // Constructor
+    EntityStore();
+
+    // Destructor
+    ~EntityStore() = default;
+
+    // Not copyable: columns live in the store's own arena
+    EntityStore(const EntityStore&) = delete;
+    EntityStore& operator=(const EntityStore&) = delete;
+
+    // Population
+    void clear();
+    void reserve(int enemyCount, int collectibleCount);
+    void swap(EntityStore& other);
+    int addEnemy(int x, int y, int delay);
+    int addCollectible(int x, int y, int points);
+    void removeEnemy(int index);
+    void removeCollectible(int index);
+
+    // Getters
+    int getEnemyCount() const { return static_cast<int>(enemyData.x.size()); }
+    int getCollectibleCount() const { return static_cast<int>(collectibleData.x.size()); }
+    EnemyColumns& enemies() { return enemyData; }
+    const EnemyColumns& enemies() const { return enemyData; }
+    CollectibleColumns& collectibles() { return collectibleData; }
+    const CollectibleColumns& collectibles() const { return collectibleData; }
+    const LevelArena& getArena() const { return *arena; }
+};
+
+#endif // ENTITYSTORE_H
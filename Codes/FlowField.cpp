@@ -0,0 +1,90 @@
+#include "FlowField.h"
+
+const uint32_t FlowField::UNREACHABLE;
+
+/**
+ * Constructor for FlowField class
+ * The field is empty until build is called
+ */
+FlowField::FlowField() : width(0), height(0), targetX(-1), targetY(-1) {
+}
+
+/**
+ * Compute distances from every open cell to a target cell
+ * Cells are packed into 16 bits per coordinate, which covers the largest
+ * supported maze (4096 x 4096)
+ * @param maze Maze to search
+ * @param goalX Target X coordinate
+ * @param goalY Target Y coordinate
+ */
+void FlowField::build(const MazeView& maze, int goalX, int goalY) {
+    width = maze.getWidth();
+    height = maze.getHeight();
+    targetX = goalX;
+    targetY = goalY;
+
+    const size_t cellCount = static_cast<size_t>(width) * height;
+    distances.assign(cellCount, UNREACHABLE);  // Same size as last time: no allocation
+    if (queue.size() < cellCount) {
+        queue.resize(cellCount);               // Every cell is queued at most once
+    }
+
+    if (!maze.isOpen(goalX, goalY)) {
+        return;
+    }
+
+    const char* cells = maze.getRow(0);
+    uint32_t* frontier = queue.data();
+    size_t head = 0, tail = 0;
+    distances[static_cast<size_t>(goalY) * width + goalX] = 0;
+    frontier[tail++] = static_cast<uint32_t>(goalX) | (static_cast<uint32_t>(goalY) << 16);
+
+    while (head < tail) {
+        const uint32_t packed = frontier[head++];
+        const int x = static_cast<int>(packed & 0xFFFF);
+        const int y = static_cast<int>(packed >> 16);
+        const size_t index = static_cast<size_t>(y) * width + x;
+        const uint32_t next = distances[index] + 1;
+
+        // Visit a neighbour if it is open and not reached yet
+        auto visit = [&](int nx, int ny, size_t neighbour) {
+            if (cells[neighbour] != '#' && distances[neighbour] == UNREACHABLE) {
+                distances[neighbour] = next;
+                frontier[tail++] = static_cast<uint32_t>(nx) | (static_cast<uint32_t>(ny) << 16);
+            }
+        };
+        if (y > 0) visit(x, y - 1, index - width);
+        if (x < width - 1) visit(x + 1, y, index + 1);
+        if (y < height - 1) visit(x, y + 1, index + width);
+        if (x > 0) visit(x - 1, y, index - 1);
+    }
+}
+
+/**
+ * Find the neighbouring cell one step closer to the target
+ * Neighbours are tried up, right, down, left, so ties break the same way
+ * @param x Current X coordinate
+ * @param y Current Y coordinate
+ * @param nextX Receives the X coordinate to move to
+ * @param nextY Receives the Y coordinate to move to
+ * @return false if the cell is not connected to the target (or is the target)
+ */
+bool FlowField::nextStep(int x, int y, int& nextX, int& nextY) const {
+    const size_t index = static_cast<size_t>(y) * width + x;
+    const uint32_t here = distances[index];
+    if (here == UNREACHABLE || here == 0) {
+        return false;
+    }
+
+    // A cell at distance d always has a neighbour at d - 1
+    if (y > 0 && distances[index - width] < here) {
+        nextX = x; nextY = y - 1;
+    } else if (x < width - 1 && distances[index + 1] < here) {
+        nextX = x + 1; nextY = y;
+    } else if (y < height - 1 && distances[index + width] < here) {
+        nextX = x; nextY = y + 1;
+    } else {
+        nextX = x - 1; nextY = y;
+    }
+    return true;
+}
@@ -0,0 +1,44 @@
+#ifndef FLOWFIELD_H
+#define FLOWFIELD_H
+
+#include "MazeView.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * FlowField class holding breadth-first distances to one target cell
+ * Built once per target position and shared by every chasing enemy: an
+ * enemy steps to whichever neighbour is closer to the target, a constant
+ * time lookup regardless of how many enemies there are. Buffers are kept
+ * between builds, so rebuilding for a maze of the same size allocates
+ * nothing.
+ */
+class FlowField {
+public:
+    static const uint32_t UNREACHABLE = 0xFFFFFFFFu;
+
+private:
+    int width, height;               // Size of the maze the field was built for
+    int targetX, targetY;            // Cell the distances lead to (-1 when not built)
+    std::vector<uint32_t> distances; // Steps to the target per cell, UNREACHABLE if cut off
+    std::vector<uint32_t> queue;     // Breadth-first frontier, cells packed as x | y << 16
+
+public:
+    // Constructor
+    FlowField();
+
+    // Destructor
+    ~FlowField() = default;
+
+    // Building
+    void build(const MazeView& maze, int goalX, int goalY);
+    void invalidate() { targetX = targetY = -1; }
+    bool isBuiltFor(int x, int y) const { return x == targetX && y == targetY; }
+
+    // Queries
+    uint32_t getDistance(int x, int y) const { return distances[static_cast<size_t>(y) * width + x]; }
+    bool nextStep(int x, int y, int& nextX, int& nextY) const;
+};
+
+#endif // FLOWFIELD_H
@@ -1,32 +1,59 @@
 #include "Game.h"
+#include "MappedFile.h"
+#include "SaveFormat.h"
 #include <iostream>
 #include <algorithm>
 #include <cstdlib>
 #include <string>
 #include <fstream>
-
-#ifdef _WIN32
-    #include <conio.h>
-    #include <windows.h>
-#else
-    #include <termios.h>
-    #include <unistd.h>
-    #include <sys/select.h>
-#endif
+#include <sstream>
+#include <cstring>
 
 /**
  * Constructor for Game class
  * Initializes game state and starts at level 1
+ * @param mazeWidth Width of the maze in cells
+ * @param mazeHeight Height of the maze in cells
+ * @param gameSeed Seed for every random choice the game makes
  */
-Game::Game() : player(1, 1), currentLevel(1), gameRunning(true), gameWon(false), gameOver(false), needsRedraw(true) {
-    initializeLevel(1);
+Game::Game(int mazeWidth, int mazeHeight, uint64_t gameSeed)
+    : Game(mazeWidth, mazeHeight, gameSeed, 1, MazeAlgorithm::ScatteredWalls) {
+}
+
+/**
+ * Constructor for Game class starting on a given level
+ * Only that level is built, so headless runners that start mid-game do
+ * not pay for generating level 1 first
+ * @param mazeWidth Width of the maze in cells
+ * @param mazeHeight Height of the maze in cells
+ * @param gameSeed Seed for every random choice the game makes
+ * @param startLevel Level to start on
+ * @param algorithm Layout of generated levels
+ */
+Game::Game(int mazeWidth, int mazeHeight, uint64_t gameSeed, int startLevel, MazeAlgorithm algorithm)
+    : maze(mazeWidth, mazeHeight), player(1, 1), pregenerator(&Game::buildLevel),
+      enemyBehavior(EnemyBehavior::Wander), mazeAlgorithm(algorithm),
+      seed(gameSeed), placementRandom(Random::deriveSeed(gameSeed, RandomStream::Placement, 0)),
+      scheduler(1000.0 / DEFAULT_TICK_INTERVAL_MS, DEFAULT_MAX_CATCH_UP_TICKS),
+      terminalColumns(DEFAULT_TERMINAL_COLUMNS), recordingInput(false), tickCount(0),
+      currentLevel(startLevel), gameRunning(true), gameWon(false), gameOver(false), needsRedraw(true),
+      pregenerateLevels(false) {
+    initializeLevel(startLevel);
 }
 
 /**
  * Main game loop
- * Handles input, updates game state, and renders
+ * Terminal front end: applies keys as they arrive, advances the simulation
+ * on a fixed timestep and renders whatever changed
  */
 void Game::run() {
+    // Raw keyboard mode for the whole session (restored on return or fatal signal)
+    input.enterRawMode();
+    TerminalRenderer::watchResize();
+
+    // Level 2 is generated while the startup menu waits for a choice
+    setLevelPregeneration(true);
+
     // Show startup menu first
     if (!showStartupMenu()) {
         return; // User chose to quit
@@ -35,27 +62,80 @@ void Game::run() {
     displayMenu();
     needsRedraw = true;
     render(); // Initial render
+    scheduler.reset();
 
     while (gameRunning) {
-        handleInput();
-        update();
-        checkCollisions();
-        checkWinCondition();
-        checkGameOver();
+        // Sleep until the next tick is due, waking early if a key arrives
+        input.waitForInput(scheduler.millisecondsUntilNextTick());
+
+        // Player moves are applied as soon as they arrive, not on the next tick
+        while (gameRunning && input.hasQueuedKeys()) {
+            applyPlayerAction(pollInput());
+        }
+
+        // Once input is closed (piped keys ran out, detached session) nothing
+        // can quit the game any more, so quit now
+        if (gameRunning && input.isEndOfInput() && !input.hasQueuedKeys()) {
+            applyPlayerAction(InputAction::Quit);
+        }
+
+        // Finished background saves are reported without waiting on the disk
+        collectSaveResults();
+
+        // Enemies advance on simulation ticks only
+        for (int ticks = scheduler.takeDueTicks(); ticks > 0 && gameRunning; ticks--) {
+            step(InputAction::None);
+        }
 
         // Only render when something has changed
         if (needsRedraw) {
             render();
             needsRedraw = false;
         }
+    }
 
-        // Optimized refresh rate for best balance of smoothness and flicker reduction
-#ifdef _WIN32
-        Sleep(120);
-#else
-        usleep(120000);
-#endif
+    input.restore();
+}
+
+/**
+ * Advance the simulation by one tick
+ * Headless: performs no terminal I/O, sleeping or console output, so it
+ * can be driven as fast as the caller likes
+ * @param action Player action to apply this tick
+ * @return true while the game is still running
+ */
+bool Game::step(InputAction action) {
+    if (recordingInput && action != InputAction::None) {
+        inputLog.append(tickCount, static_cast<uint8_t>(action), true);
     }
+    handleInput(action);
+    update();
+    checkCollisions();
+    checkWinCondition();
+    checkGameOver();
+    tickCount++;
+    return gameRunning;
+}
+
+/**
+ * Apply a player action between ticks without advancing the enemies
+ * Lets the interactive loop respond to a key immediately while enemy
+ * timers stay tied to simulation ticks
+ * @param action Player action to apply
+ * @return true while the game is still running
+ */
+bool Game::applyPlayerAction(InputAction action) {
+    if (action == InputAction::None) {
+        return gameRunning;
+    }
+    if (recordingInput) {
+        inputLog.append(tickCount, static_cast<uint8_t>(action), false);
+    }
+    handleInput(action);
+    checkCollisions();
+    checkWinCondition();
+    checkGameOver();
+    return gameRunning;
 }
 
 /**
@@ -65,71 +145,106 @@ void Game::update() {
     // Update player
     player.update();
 
-    // Update enemies
-    for (auto& enemy : enemies) {
-        enemy->update();
-        if (enemy->isActive()) {
-            // Get maze grid for movement validation
-            char mazeGrid[10][10];
-            for (int i = 0; i < 10; i++) {
-                for (int j = 0; j < 10; j++) {
-                    mazeGrid[i][j] = maze.getCell(j, i);
-                }
-            }
-            int oldX = enemy->getX();
-            int oldY = enemy->getY();
-            enemy->moveRandomly(mazeGrid);
-            // Check if enemy actually moved
-            if (oldX != enemy->getX() || oldY != enemy->getY()) {
-                needsRedraw = true;
-            }
-        }
+    // Update enemies in one linear pass over the enemy columns
+    // (collectibles are passive and need no update)
+    static const int directionX[4] = {0, 1, 0, -1};  // Up, right, down, left
+    static const int directionY[4] = {-1, 0, 1, 0};
+
+    const MazeView mazeView = maze.view();
+    EnemyColumns& enemy = entities.enemies();
+    const int enemyCount = entities.getEnemyCount();
+
+    // Chasing enemies share one distance field, rebuilt only when the player has moved
+    const bool chasing = enemyBehavior == EnemyBehavior::Chase && enemyCount > 0;
+    if (chasing && !chaseField.isBuiltFor(player.getX(), player.getY())) {
+        chaseField.build(mazeView, player.getX(), player.getY());
     }
 
-    // Update collectibles
-    for (auto& collectible : collectibles) {
-        collectible->update();
+    for (int i = 0; i < enemyCount; i++) {
+        if (!enemy.active[i]) {
+            continue;
+        }
+
+        // Only move if timer has reached delay
+        if (++enemy.moveTimer[i] < enemy.moveDelay[i]) {
+            continue;
+        }
+        enemy.moveTimer[i] = 0;
+
+        // Step downhill on the distance field when chasing; otherwise (or when
+        // cut off from the player) try a random direction, staying put if blocked
+        int newX, newY;
+        if (!chasing || !chaseField.nextStep(enemy.x[i], enemy.y[i], newX, newY)) {
+            int direction = enemyRandom.below(4);
+            newX = enemy.x[i] + directionX[direction];
+            newY = enemy.y[i] + directionY[direction];
+        }
+        if (mazeView.isOpen(newX, newY)) {
+            occupancy.moveEnemy(enemy.x[i], enemy.y[i], newX, newY);
+            enemy.x[i] = newX;
+            enemy.y[i] = newY;
+            needsRedraw = true;
+        }
     }
 }
 
 /**
- * Render the complete game state
+ * Render the part of the game the camera sees
+ * Only the cells in the terminal-sized window are composed and compared,
+ * so the cost of a frame does not depend on the size of the maze
  */
 void Game::render() {
-    // Build complete frame in string first - simple double buffering
-    std::string frame = "";
-
-    // Create display grid
-    char displayGrid[10][10];
-    for (int i = 0; i < 10; i++) {
-        for (int j = 0; j < 10; j++) {
-            displayGrid[i][j] = maze.getCell(j, i);
-        }
+    // Refit the window when the terminal has been resized (and on the first frame)
+    if (TerminalRenderer::takeResize()) {
+        int columns = DEFAULT_TERMINAL_COLUMNS;
+        int rows = DEFAULT_TERMINAL_ROWS;
+        TerminalRenderer::queryTerminalSize(columns, rows);
+        camera.fitTerminal(columns, rows, STATUS_ROWS);
+        terminalColumns = columns;
+        renderer.invalidate();
     }
-
-    // Place collectibles
-    for (const auto& collectible : collectibles) {
-        if (collectible->isActive() && !collectible->isCollected()) {
-            displayGrid[collectible->getY()][collectible->getX()] = collectible->getSymbol();
+    camera.follow(player.getX(), player.getY(), maze.getWidth(), maze.getHeight());
+
+    // Compose into reused buffers, then let the renderer send only what changed
+    const int width = camera.getWidth();
+    const int height = camera.getHeight();
+    displayGrid.resize(static_cast<size_t>(width) * height);
+    composeWindow(displayGrid.data(), camera.getLeft(), camera.getTop(), width, height);
+    composeStatus(statusLines);
+
+    // A line that wraps would take a row the camera did not leave free
+    const size_t maxStatusLength = static_cast<size_t>(std::max(terminalColumns - 1, 0));
+    for (std::string& line : statusLines) {
+        if (line.size() > maxStatusLength) {
+            line.resize(maxStatusLength);
         }
     }
+    renderer.present(displayGrid.data(), width, height, statusLines);
+}
 
-    // Place enemies
-    for (const auto& enemy : enemies) {
-        if (enemy->isActive()) {
-            displayGrid[enemy->getY()][enemy->getX()] = enemy->getSymbol();
-        }
-    }
+/**
+ * Build the text of one frame (the camera's window with entities, plus status lines)
+ * Performs no output, so it can render into any memory buffer
+ * @param frame Buffer to write the frame into (previous contents are replaced)
+ */
+void Game::composeFrame(std::string& frame) const {
+    Camera view = camera;
+    view.follow(player.getX(), player.getY(), maze.getWidth(), maze.getHeight());
 
-    // Place player
-    if (player.isActive()) {
-        displayGrid[player.getY()][player.getX()] = player.getSymbol();
-    }
+    const int width = view.getWidth();
+    const int height = view.getHeight();
+    std::vector<char> grid(static_cast<size_t>(width) * height);
+    std::vector<std::string> status;
+    composeWindow(grid.data(), view.getLeft(), view.getTop(), width, height);
+    composeStatus(status);
+
+    frame.clear();
+    frame.reserve(static_cast<size_t>(width * 2 + 1) * height + 512);
 
     // Build maze display
-    for (int i = 0; i < 10; i++) {
-        for (int j = 0; j < 10; j++) {
-            frame += displayGrid[i][j];
+    for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+            frame += grid[i * width + j];
             frame += " ";
         }
         frame += "\n";
@@ -137,107 +252,196 @@ void Game::render() {
 
     // Add game info
     frame += "\n";
-    frame += "Level: " + std::to_string(currentLevel) +
-             " | Score: " + std::to_string(player.getScore()) +
-             " | Moves: " + std::to_string(player.getMoveCount()) + "\n";
-    frame += "Controls: WASD to move, Q to quit, R to restart, P to save menu, L to load menu\n";
+    for (const std::string& line : status) {
+        frame += line;
+        frame += "\n";
+    }
+}
+
+/**
+ * Compose the display grid: maze cells with entities drawn on top
+ * @param grid Row-major buffer to fill (resized to the maze)
+ */
+void Game::composeDisplay(std::vector<char>& grid) const {
+    grid.resize(static_cast<size_t>(maze.getWidth()) * maze.getHeight());
+    composeDisplay(grid.data());
+}
+
+/**
+ * Compose the display grid into caller-owned memory
+ * @param grid Row-major buffer of at least width * height characters
+ */
+void Game::composeDisplay(char* grid) const {
+    composeWindow(grid, 0, 0, maze.getWidth(), maze.getHeight());
+}
+
+/**
+ * Compose a rectangular window of the display grid
+ * Reads only the maze rows and occupancy cells inside the window
+ * @param grid Row-major buffer of at least width * height characters
+ * @param left First maze column of the window
+ * @param top First maze row of the window
+ * @param width Window width in cells (the window must lie inside the maze)
+ * @param height Window height in cells
+ */
+void Game::composeWindow(char* grid, int left, int top, int width, int height) const {
+    // Enemies are drawn over collectibles, which are drawn over the maze
+    const MazeView mazeView = maze.view();
+    for (int i = 0; i < height; i++) {
+        const int y = top + i;
+        const char* mazeRow = mazeView.getRow(y);
+        char* gridRow = grid + static_cast<size_t>(i) * width;
+        for (int j = 0; j < width; j++) {
+            const int x = left + j;
+            char cell;
+            if (occupancy.hasEnemy(x, y)) {
+                cell = 'X';
+            } else if (occupancy.hasCollectible(x, y)) {
+                cell = '*';
+            } else {
+                cell = mazeRow[x];
+            }
+            gridRow[j] = cell;
+        }
+    }
+
+    // Place player, if inside the window
+    const int playerColumn = player.getX() - left;
+    const int playerRow = player.getY() - top;
+    if (player.isActive() && playerColumn >= 0 && playerColumn < width && playerRow >= 0 && playerRow < height) {
+        grid[static_cast<size_t>(playerRow) * width + playerColumn] = player.getSymbol();
+    }
+}
+
+/**
+ * Compose the status lines shown below the maze
+ * @param lines Buffer to fill (previous contents are replaced)
+ */
+void Game::composeStatus(std::vector<std::string>& lines) const {
+    lines.clear();
+    lines.push_back("Level: " + std::to_string(currentLevel) +
+                    " | Score: " + std::to_string(player.getScore()) +
+                    " | Moves: " + std::to_string(player.getMoveCount()));
+    lines.push_back("Controls: WASD to move, Q to quit, R to restart, P to save menu, L to load menu");
+
+    if (!saveStatus.empty()) {
+        lines.push_back(saveStatus);
+    }
 
     if (gameWon && currentLevel < MAX_LEVELS) {
-        frame += "Level Complete! Press N for next level\n";
+        lines.push_back("Level Complete! Press N for next level");
     }
 
     if (gameOver) {
-        frame += "\nGAME OVER! You collided with an enemy!\n";
-        frame += "Final Score: " + std::to_string(player.getScore()) + "\n";
+        lines.push_back("");
+        lines.push_back("GAME OVER! You collided with an enemy!");
+        lines.push_back("Final Score: " + std::to_string(player.getScore()));
     } else if (gameWon && currentLevel >= MAX_LEVELS) {
-        frame += "\nCONGRATULATIONS! You completed all levels!\n";
-        frame += "Final Score: " + std::to_string(player.getScore()) + "\n";
-        frame += "Total Moves: " + std::to_string(player.getMoveCount()) + "\n";
+        lines.push_back("");
+        lines.push_back("CONGRATULATIONS! You completed all levels!");
+        lines.push_back("Final Score: " + std::to_string(player.getScore()));
+        lines.push_back("Total Moves: " + std::to_string(player.getMoveCount()));
     }
 
-    // Clear and display everything at once - minimal flicker
-    maze.clearScreen();
-    std::cout << frame;
-    std::cout.flush();
+    // The camera only leaves room for this many below the maze
+    if (lines.size() > static_cast<size_t>(MAX_STATUS_LINES)) {
+        lines.resize(MAX_STATUS_LINES);
+    }
 }
 
 /**
- * Handle player input
+ * Apply a player action to the game state
+ * Menu actions need the terminal and are handled by pollInput instead
+ * @param action Action to apply
  */
-void Game::handleInput() {
-    char input = getInput();
-
-    switch (input) {
-        case 'w': case 'W':
+void Game::handleInput(InputAction action) {
+    switch (action) {
+        case InputAction::MoveUp:
             movePlayer(0, -1);
             break;
-        case 's': case 'S':
+        case InputAction::MoveDown:
             movePlayer(0, 1);
             break;
-        case 'a': case 'A':
+        case InputAction::MoveLeft:
             movePlayer(-1, 0);
             break;
-        case 'd': case 'D':
+        case InputAction::MoveRight:
             movePlayer(1, 0);
             break;
-        case 'q': case 'Q':
+        case InputAction::Quit:
             gameRunning = false;
             break;
-        case 'r': case 'R':
+        case InputAction::Restart:
             resetGame();
             needsRedraw = true;
             break;
-        case 'n': case 'N':
+        case InputAction::NextLevel:
             if (gameWon && currentLevel < MAX_LEVELS) {
                 nextLevel();
                 needsRedraw = true;
             }
             break;
-        case 'l': case 'L':
+        case InputAction::SaveMenu:
+        case InputAction::LoadMenu:
+        case InputAction::None:
+            break;
+    }
+}
+
+/**
+ * Read a key from the terminal and turn it into an action
+ * Save and load menus are run here, since they talk to the terminal
+ * @return Action for the simulation step (None if nothing to apply)
+ */
+InputAction Game::pollInput() {
+    InputAction action = actionFromKey(getInput());
+
+    switch (action) {
+        case InputAction::LoadMenu:
             displayLoadMenu();
+            renderer.invalidate(); // The menu replaced the frame on screen
+            scheduler.reset();     // Don't replay the ticks spent in the menu
             needsRedraw = true;
-            break;
-        case 'p': case 'P':
+            return InputAction::None;
+        case InputAction::SaveMenu:
             displaySaveMenu();
+            renderer.invalidate();
+            scheduler.reset();
             needsRedraw = true;
-            break;
+            return InputAction::None;
+        default:
+            return action;
     }
 }
 
 /**
- * Get character input from user
- * @return Character entered by user
+ * Map a key press to a player action
+ * @param key Character read from the keyboard
+ * @return Matching action, or None for unbound keys
  */
-char Game::getInput() const {
-#ifdef _WIN32
-    if (_kbhit()) {
-        return _getch();
-    }
-    return 0;
-#else
-    // Non-blocking input for Unix-like systems
-    struct termios oldt, newt;
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-
-    fd_set readfds;
-    FD_ZERO(&readfds);
-    FD_SET(STDIN_FILENO, &readfds);
-
-    struct timeval timeout;
-    timeout.tv_sec = 0;
-    timeout.tv_usec = 1000; // 1ms timeout
-
-    char ch = 0;
-    if (select(STDIN_FILENO + 1, &readfds, NULL, NULL, &timeout) > 0) {
-        read(STDIN_FILENO, &ch, 1);
+InputAction Game::actionFromKey(char key) {
+    switch (key) {
+        case 'w': case 'W': return InputAction::MoveUp;
+        case 's': case 'S': return InputAction::MoveDown;
+        case 'a': case 'A': return InputAction::MoveLeft;
+        case 'd': case 'D': return InputAction::MoveRight;
+        case 'q': case 'Q': return InputAction::Quit;
+        case 'r': case 'R': return InputAction::Restart;
+        case 'n': case 'N': return InputAction::NextLevel;
+        case 'l': case 'L': return InputAction::LoadMenu;
+        case 'p': case 'P': return InputAction::SaveMenu;
+        default: return InputAction::None;
     }
+}
 
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-    return ch;
-#endif
+/**
+ * Get the next queued key without waiting
+ * @return Character entered by user, or 0 if no key is pending
+ */
+char Game::getInput() {
+    char key = 0;
+    input.popKey(key);
+    return key;
 }
 
 /**
@@ -250,39 +454,200 @@ void Game::initializeLevel(int level) {
     gameOver = false;
     needsRedraw = true;
 
-    // Initialize maze for level
-    maze.initializeMaze(level);
-
     // Reset player position
     player.setPosition(1, 1);
     player.setActive(true);
+    chaseField.invalidate(); // New maze, even if the player is on the same cell
+    enemyRandom.reseed(Random::deriveSeed(seed, RandomStream::EnemyAI, static_cast<uint64_t>(level)));
+
+    // Swap in the pregenerated level if it is ready, otherwise build it now;
+    // both give the same level for the same seed
+    const LevelSpec spec = levelSpec(level);
+    if (!pregenerateLevels || !pregenerator.take(spec, maze, entities, occupancy)) {
+        buildLevel(spec, maze, entities, occupancy);
+    }
+
+    requestNextLevel();
+}
+
+/**
+ * Start building the level after the current one in the background
+ * Does nothing unless pregeneration is enabled
+ */
+void Game::requestNextLevel() {
+    if (pregenerateLevels && currentLevel < MAX_LEVELS) {
+        pregenerator.request(levelSpec(currentLevel + 1));
+    }
+}
+
+/**
+ * Describe a level of this game at the current maze size and layout
+ * @param level Level number
+ * @return Everything needed to build the level
+ */
+LevelSpec Game::levelSpec(int level) const {
+    const LevelSpec spec = {level, maze.getWidth(), maze.getHeight(), mazeAlgorithm, seed};
+    return spec;
+}
+
+/**
+ * Turn background generation of the next level on or off
+ * Off by default so headless runs stay single-threaded and reproducible
+ * @param enabled Whether to pregenerate levels
+ */
+void Game::setLevelPregeneration(bool enabled) {
+    pregenerateLevels = enabled;
+    if (enabled) {
+        requestNextLevel();
+    } else {
+        pregenerator.cancel();
+    }
+}
+
+/**
+ * Choose how later levels are laid out
+ * Takes effect from the next level built; a pregenerated level with the
+ * old layout is replaced
+ * @param algorithm Maze layout algorithm
+ */
+void Game::setMazeAlgorithm(MazeAlgorithm algorithm) {
+    mazeAlgorithm = algorithm;
+    requestNextLevel();
+}
+
+/**
+ * Replace all enemies and collectibles with freshly placed ones
+ * Entities are placed on random open cells away from the player and exit
+ * @param enemyCount Number of enemies to place
+ * @param collectibleCount Number of collectibles to place
+ * Performs no output; on false, the counts in getEntities tell how
+ * many were placed
+ * @return false if the maze did not have room for all of them
+ */
+bool Game::spawnEntities(int enemyCount, int collectibleCount) {
+    if (!placeEntities(maze, player.getX(), player.getY(), currentLevel, enemyCount, collectibleCount,
+                       placementRandom, entities, occupancy)) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Build a complete level into the given objects: the maze, then enemies
+ * and collectibles (more of both on higher levels)
+ * Touches no Game state, so it can run on the pregeneration worker. The
+ * random streams come from the spec alone, so the result does not depend
+ * on which thread builds it or what was built before.
+ * @param spec Level to build
+ * @param levelMaze Receives the maze
+ * @param levelEntities Receives the enemies and collectibles
+ * @param levelOccupancy Receives the entity index
+ */
+void Game::buildLevel(const LevelSpec& spec, Maze& levelMaze, EntityStore& levelEntities,
+                      OccupancyGrid& levelOccupancy) {
+    const uint64_t level = static_cast<uint64_t>(spec.level);
+    if (spec.width != levelMaze.getWidth() || spec.height != levelMaze.getHeight()) {
+        levelMaze.resize(spec.width, spec.height);
+    }
+    levelMaze.reseed(Random::deriveSeed(spec.seed, RandomStream::Generation, level));
+    levelMaze.initializeMaze(spec.level, spec.algorithm);
 
+    // A maze too small for every entity gets as many as fit
+    Random placement(Random::deriveSeed(spec.seed, RandomStream::Placement, level));
+    placeEntities(levelMaze, 1, 1, spec.level, std::min(spec.level, 3), 3 + spec.level, placement,
+                  levelEntities, levelOccupancy);
+}
+
+/**
+ * Place a level's enemies and collectibles on random open cells
+ * Cells are drawn without replacement from the occupancy grid's free-cell
+ * index, so each entity gets a cell of its own and the cost does not
+ * depend on how crowded the maze is. Collectibles are limited to cells
+ * the player can reach. If the maze runs out of room, as many entities as
+ * fit are placed (collectibles before enemies) and false is returned.
+ * @param levelMaze Maze to place them in
+ * @param playerX Player X coordinate (kept clear)
+ * @param playerY Player Y coordinate (kept clear)
+ * @param level Level number (sets enemy speed and item value)
+ * @param enemyCount Number of enemies to place
+ * @param collectibleCount Number of collectibles to place
+ * @param random Random stream choosing the cells
+ * @param levelEntities Receives the entities (previous contents are replaced)
+ * @param levelOccupancy Receives the entity index
+ * @return true if every entity was placed
+ */
+bool Game::placeEntities(const Maze& levelMaze, int playerX, int playerY, int level,
+                         int enemyCount, int collectibleCount, Random& random,
+                         EntityStore& levelEntities, OccupancyGrid& levelOccupancy) {
     // Clear existing entities
-    enemies.clear();
-    collectibles.clear();
+    levelEntities.clear();
+    levelEntities.reserve(enemyCount, collectibleCount);
+
+    levelOccupancy.reset(levelMaze.getWidth(), levelMaze.getHeight(), collectibleCount);
+    levelOccupancy.indexFreeCells(levelMaze, playerX, playerY);
+
+    // Collectibles first: they can only go where the player can get to
+    // them, while enemies can use any open cell that is left
+    for (int i = 0; i < collectibleCount; i++) {
+        int x, y;
+        if (!levelOccupancy.takeFreeCell(random, true, x, y)) {
+            break;
+        }
+        int index = levelEntities.addCollectible(x, y, 10 * level);
+        levelOccupancy.addCollectible(index, x, y);
+    }
 
-    // Add enemies based on level (more enemies on higher levels)
-    int enemyCount = std::min(level, 3);
     for (int i = 0; i < enemyCount; i++) {
         int x, y;
-        do {
-            x = rand() % 8 + 1; // Avoid borders
-            y = rand() % 8 + 1;
-        } while (maze.isWall(x, y) || (x == 1 && y == 1) || maze.isExit(x, y));
+        if (!levelOccupancy.takeFreeCell(random, false, x, y)) {
+            break;
+        }
+        levelEntities.addEnemy(x, y, 3 + level);
+        levelOccupancy.addEnemy(x, y);
+    }
+
+    return levelEntities.getEnemyCount() == enemyCount &&
+           levelEntities.getCollectibleCount() == collectibleCount;
+}
 
-        enemies.push_back(std::unique_ptr<Enemy>(new Enemy(x, y, 3 + level)));
+/**
+ * Add every entity in the entity columns to the occupancy index
+ * Used after entity state is replaced wholesale, e.g. by loading a save
+ */
+void Game::indexEntities() {
+    const EnemyColumns& enemy = entities.enemies();
+    const CollectibleColumns& collectible = entities.collectibles();
+
+    for (int i = 0; i < entities.getEnemyCount(); i++) {
+        if (enemy.active[i]) {
+            occupancy.addEnemy(enemy.x[i], enemy.y[i]);
+        }
     }
+    for (int i = 0; i < entities.getCollectibleCount(); i++) {
+        if (!collectible.collected[i]) {
+            occupancy.addCollectible(i, collectible.x[i], collectible.y[i]);
+        }
+    }
+}
 
-    // Add collectibles (more on higher levels)
-    int collectibleCount = 3 + level;
-    for (int i = 0; i < collectibleCount; i++) {
-        int x, y;
-        do {
-            x = rand() % 8 + 1;
-            y = rand() % 8 + 1;
-        } while (maze.isWall(x, y) || (x == 1 && y == 1) || maze.isExit(x, y));
+/**
+ * Remove every entity in the entity columns from the occupancy index
+ * Leaves the per-cell index empty at a cost proportional to the entity
+ * count rather than the maze size
+ */
+void Game::unindexEntities() {
+    const EnemyColumns& enemy = entities.enemies();
+    const CollectibleColumns& collectible = entities.collectibles();
 
-        collectibles.push_back(std::unique_ptr<Collectible>(new Collectible(x, y, 10 * level)));
+    for (int i = 0; i < entities.getEnemyCount(); i++) {
+        if (enemy.active[i]) {
+            occupancy.removeEnemy(enemy.x[i], enemy.y[i]);
+        }
+    }
+    for (int i = 0; i < entities.getCollectibleCount(); i++) {
+        if (!collectible.collected[i]) {
+            occupancy.clearCollectibles(collectible.x[i], collectible.y[i]);
+        }
     }
 }
 
@@ -296,11 +661,121 @@ void Game::nextLevel() {
     }
 }
 
+/**
+ * Start a new game from level 1 and record every action applied to it
+ * The recording can be replayed with replayLog to reproduce the session
+ */
+void Game::startRecording() {
+    resetGame();
+    tickCount = 0;
+    inputLog.begin(seed, maze.getWidth(), maze.getHeight(),
+                   static_cast<uint8_t>(mazeAlgorithm), static_cast<uint8_t>(enemyBehavior));
+    recordingInput = true;
+}
+
+/**
+ * Stop recording and hand over the session with its final state
+ * @param log Receives the recording
+ * @return false if nothing was being recorded (never started, or stopped by loading a save)
+ */
+bool Game::finishRecording(InputLog& log) {
+    if (!recordingInput) {
+        return false;
+    }
+    recordingInput = false;
+    inputLog.finish(captureOutcome());
+    log = inputLog;
+    return true;
+}
+
+/**
+ * Summarise the current state for comparing a replay with its recording
+ * @return Score, moves, positions and flags of the game right now
+ */
+ReplayOutcome Game::captureOutcome() const {
+    ReplayOutcome outcome;
+    std::memset(&outcome, 0, sizeof(outcome));
+
+    // FNV-1a over active enemy positions, in entity order
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    const EnemyColumns& enemy = entities.enemies();
+    for (int i = 0; i < entities.getEnemyCount(); i++) {
+        if (enemy.active[i]) {
+            hash = (hash ^ static_cast<uint32_t>(enemy.x[i])) * 0x100000001B3ULL;
+            hash = (hash ^ static_cast<uint32_t>(enemy.y[i])) * 0x100000001B3ULL;
+        }
+    }
+
+    outcome.enemyHash = hash;
+    outcome.ticks = tickCount;
+    outcome.level = currentLevel;
+    outcome.score = player.getScore();
+    outcome.moves = player.getMoveCount();
+    outcome.playerX = player.getX();
+    outcome.playerY = player.getY();
+    outcome.flags = (gameRunning ? REPLAY_FLAG_RUNNING : 0) | (gameWon ? REPLAY_FLAG_LEVEL_WON : 0) |
+                    (gameOver ? REPLAY_FLAG_GAME_OVER : 0);
+    return outcome;
+}
+
+/**
+ * Replay a recording headlessly, as fast as possible
+ * Builds a game from the recorded seed and settings, feeds it the recorded
+ * actions on their ticks and runs it to the recorded tick count
+ * @param log Recording to replay
+ * @param outcome Receives the state the replay ended in
+ * @return true if it matches the recorded outcome
+ */
+bool Game::replayLog(const InputLog& log, ReplayOutcome& outcome) {
+    Game game(log.getWidth(), log.getHeight(), log.getSeed());
+    game.enemyBehavior = static_cast<EnemyBehavior>(log.getEnemyBehavior());
+    game.mazeAlgorithm = static_cast<MazeAlgorithm>(log.getMazeAlgorithm());
+    if (game.mazeAlgorithm != MazeAlgorithm::ScatteredWalls) {
+        game.resetGame(); // Level 1 was built with the default layout
+    }
+
+    InputEvent event = {0, 0, false};
+    size_t offset = 0;
+    while (log.nextEvent(offset, event)) {
+        while (game.tickCount < event.tick) {
+            game.step(InputAction::None);
+        }
+        const InputAction action = static_cast<InputAction>(event.action);
+        if (event.stepped) {
+            game.step(action);
+        } else {
+            game.applyPlayerAction(action);
+        }
+    }
+    while (game.tickCount < log.getOutcome().ticks) {
+        game.step(InputAction::None);
+    }
+
+    outcome = game.captureOutcome();
+    return outcome == log.getOutcome();
+}
+
+/**
+ * Start a different game in place, as if constructed with a new seed
+ * Keeps the maze size, layout algorithm and enemy behaviour, and reuses
+ * the existing buffers
+ * @param gameSeed Seed for the new game
+ */
+void Game::newGame(uint64_t gameSeed) {
+    seed = gameSeed;
+    placementRandom.reseed(Random::deriveSeed(gameSeed, RandomStream::Placement, 0));
+    tickCount = 0;
+    recordingInput = false; // Any recording belongs to the previous game
+    resetGame();
+}
+
 /**
  * Reset the current game
  */
 void Game::resetGame() {
+    gameRunning = true;
     player.resetStats();
+    pregenerator.cancel(); // Whatever was being prepared belongs to the abandoned game
     initializeLevel(1);
     needsRedraw = true;
 }
@@ -347,35 +822,34 @@ void Game::checkCollisions() {
 
 /**
  * Check collisions with enemies
+ * Only the player's cell is looked up in the occupancy index
  */
 void Game::checkEnemyCollisions() {
-    for (const auto& enemy : enemies) {
-        if (enemy->isActive() &&
-            enemy->getX() == player.getX() &&
-            enemy->getY() == player.getY()) {
-            gameOver = true;
-            gameRunning = false;
-            needsRedraw = true;
-            return;
-        }
+    if (occupancy.hasEnemy(player.getX(), player.getY())) {
+        gameOver = true;
+        gameRunning = false;
+        needsRedraw = true;
     }
 }
 
 /**
  * Check collisions with collectibles
+ * Collects everything the occupancy index lists on the player's cell
  */
 void Game::checkCollectibleCollisions() {
-    for (auto& collectible : collectibles) {
-        if (collectible->isActive() &&
-            !collectible->isCollected() &&
-            collectible->getX() == player.getX() &&
-            collectible->getY() == player.getY()) {
-
-            collectible->collect();
-            player.addScore(collectible->getPointValue());
-            needsRedraw = true;
-        }
+    const int x = player.getX();
+    const int y = player.getY();
+    if (!occupancy.hasCollectible(x, y)) {
+        return;
     }
+
+    CollectibleColumns& collectible = entities.collectibles();
+    for (int i = occupancy.firstCollectible(x, y); i >= 0; i = occupancy.nextCollectible(i)) {
+        collectible.collected[i] = 1;
+        player.addScore(collectible.pointValue[i]);
+    }
+    occupancy.clearCollectibles(x, y);
+    needsRedraw = true;
 }
 
 /**
@@ -400,13 +874,7 @@ void Game::movePlayer(int deltaX, int deltaY) {
  * @return true if movement is valid
  */
 bool Game::isValidPlayerMove(int newX, int newY) const {
-    // Check bounds
-    if (newX < 0 || newX >= 10 || newY < 0 || newY >= 10) {
-        return false;
-    }
-
-    // Check for walls
-    return !maze.isWall(newX, newY);
+    return player.canMoveTo(newX, newY, maze.view());
 }
 
 
@@ -414,7 +882,7 @@ bool Game::isValidPlayerMove(int newX, int newY) const {
 /**
  * Display game menu
  */
-void Game::displayMenu() const {
+void Game::displayMenu() {
     maze.clearScreen();
     std::cout << "=== MAZE GAME ===" << std::endl;
     std::cout << "Navigate through the maze to reach the exit (E)" << std::endl;
@@ -430,11 +898,7 @@ void Game::displayMenu() const {
     std::cout << std::endl;
     std::cout << "Press any key to start..." << std::endl;
 
-#ifdef _WIN32
-    _getch();
-#else
-    getchar();
-#endif
+    waitForKeyPress();
 }
 
 /**
@@ -461,93 +925,393 @@ void Game::loadGame() {
 
 /**
  * Save complete game state to a specific slot
+ * Written in the binary format described in SaveFormat.h
  */
 void Game::saveGameToSlot(int slot) const {
-    std::string filename = "maze_save_" + std::to_string(slot) + ".txt";
-    std::ofstream file(filename);
+    std::string filename = slotFilename(slot);
+    std::ofstream file(filename, std::ios::binary);
 
     if (!file.is_open()) {
         std::cout << "Failed to save game to slot " << slot << "!" << std::endl;
         return;
     }
 
-    // Save game state
-    file << "MAZEGAME_SAVE_V1" << std::endl;  // File format identifier
-    file << currentLevel << std::endl;         // Current level
-    file << player.getScore() << std::endl;    // Player score
-    file << player.getMoveCount() << std::endl; // Player moves
-    file << player.getX() << " " << player.getY() << std::endl; // Player position
+    std::vector<char> image;
+    buildSaveImage(image);
+    file.write(image.data(), static_cast<std::streamsize>(image.size()));
+    file.close();
 
-    // Save maze layout
-    for (int i = 0; i < 10; i++) {
-        for (int j = 0; j < 10; j++) {
-            file << maze.getCell(j, i);
-        }
-        file << std::endl;
+    if (!file) {
+        std::cout << "Failed to save game to slot " << slot << "!" << std::endl;
+        return;
     }
+    std::cout << "Complete game state saved to slot " << slot << " successfully!" << std::endl;
+}
 
-    // Save exit position
-    int exitX, exitY;
-    maze.getExitPosition(exitX, exitY);
-    file << exitX << " " << exitY << std::endl;
+/**
+ * Save complete game state to a specific slot without waiting for the disk
+ * The state is copied now; sealing, writing and flushing happen on the
+ * save worker, and the outcome is picked up by collectSaveResults
+ */
+void Game::queueSaveToSlot(int slot) {
+    std::vector<char> image;
+    snapshotSaveImage(image);
+    saveWriter.submit(slot, slotFilename(slot), image);
+    std::cout << "Saving game to slot " << slot << " in the background..." << std::endl;
+}
 
-    file.close();
-    std::cout << "Complete game state saved to slot " << slot << " successfully!" << std::endl;
+/**
+ * Report background saves that have finished since the last call
+ * Never waits; the result is shown on the status line
+ */
+void Game::collectSaveResults() {
+    SaveResult result;
+    while (saveWriter.pollResult(result)) {
+        saveStatus = result.success
+            ? "Game saved to slot " + std::to_string(result.slot)
+            : "Failed to save game to slot " + std::to_string(result.slot) + "!";
+        needsRedraw = true;
+    }
+}
+
+/**
+ * Get the file name used for a save slot
+ * @param slot Slot number
+ * @return File name of the slot
+ */
+std::string Game::slotFilename(int slot) {
+    return "maze_save_" + std::to_string(slot) + ".txt";
 }
 
 /**
  * Load complete game state from a specific slot
+ * Binary saves are used in place through a memory mapping; older text
+ * saves (MAZEGAME_SAVE_V1) are still accepted
  */
 void Game::loadGameFromSlot(int slot) {
-    std::string filename = "maze_save_" + std::to_string(slot) + ".txt";
-    std::ifstream file(filename);
+    saveWriter.waitUntilIdle(); // A save still being written must not be read back half-done
 
-    if (!file.is_open()) {
+    std::string filename = slotFilename(slot);
+    MappedFile file;
+
+    if (!file.open(filename)) {
         std::cout << "Failed to load game from slot " << slot << "! File may not exist." << std::endl;
         return;
     }
 
+    if (file.size() >= sizeof(SAVE_MAGIC) && std::memcmp(file.data(), SAVE_MAGIC, sizeof(SAVE_MAGIC)) == 0) {
+        if (!applySaveImage(file.data(), file.size())) {
+            std::cout << "Save file is damaged or incomplete!" << std::endl;
+            return;
+        }
+    } else if (!applyTextSave(file.data(), file.size())) {
+        return;
+    }
+
+    requestNextLevel(); // The level, and so the one after it, may have changed
+    if (recordingInput) {
+        recordingInput = false; // The loaded state did not come from the recorded seed
+        std::cout << "Input recording stopped: a loaded game cannot be replayed." << std::endl;
+    }
+    std::cout << "Complete game state loaded from slot " << slot << " successfully!" << std::endl;
+    std::cout << "Level: " << currentLevel << " | Score: " << player.getScore() << " | Moves: " << player.getMoveCount() << std::endl;
+}
+
+/**
+ * Copy a column of fixed-width values out of a save image
+ * @param column Column to fill
+ * @param source First byte of the column in the image
+ * @param count Number of values
+ */
+template <typename T>
+static void readColumn(EntityColumn<T>& column, const char* source, uint32_t count) {
+    column.resize(count);
+    if (count > 0) {
+        std::memcpy(column.data(), source, count * sizeof(T));
+    }
+}
+
+/**
+ * Append a column of fixed-width values to a save image
+ * @param column Column to store
+ * @param target First byte of the column in the image
+ * @return Byte just past the column
+ */
+template <typename T>
+static char* writeColumn(const EntityColumn<T>& column, char* target) {
+    if (!column.empty()) {
+        std::memcpy(target, column.data(), column.size() * sizeof(T));
+    }
+    return target + column.size() * sizeof(T);
+}
+
+/**
+ * Check that every position in a pair of int32 columns lies inside the maze
+ * @param xs X column in a save image
+ * @param ys Y column in a save image
+ * @param count Number of positions
+ * @param width Maze width
+ * @param height Maze height
+ * @return true if all positions are valid
+ */
+static bool positionsInside(const char* xs, const char* ys, uint32_t count, int width, int height) {
+    for (uint32_t i = 0; i < count; i++) {
+        int32_t x, y;
+        std::memcpy(&x, xs + i * sizeof(int32_t), sizeof(int32_t));
+        std::memcpy(&y, ys + i * sizeof(int32_t), sizeof(int32_t));
+        if (x < 0 || y < 0 || x >= width || y >= height) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Serialize the complete game state into the binary save format
+ * @param image Receives the file contents (reused if already large enough)
+ */
+void Game::buildSaveImage(std::vector<char>& image) const {
+    snapshotSaveImage(image);
+    sealSaveImage(image.data(), image.size());
+}
+
+/**
+ * Copy the complete game state into a save image, without its checksum
+ * The cheap part of saving: plain copies of the grid and entity columns.
+ * The image must be passed to sealSaveImage before it is written.
+ * @param image Receives the file contents (reused if already large enough)
+ */
+void Game::snapshotSaveImage(std::vector<char>& image) const {
+    const EnemyColumns& enemy = entities.enemies();
+    const CollectibleColumns& collectible = entities.collectibles();
+    const uint32_t enemyCount = static_cast<uint32_t>(entities.getEnemyCount());
+    const uint32_t collectibleCount = static_cast<uint32_t>(entities.getCollectibleCount());
+    const SaveLayout layout = SaveLayout::compute(maze.getWidth(), maze.getHeight(), enemyCount, collectibleCount);
+
+    image.assign(layout.totalSize, 0);
+
+    SaveHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SAVE_MAGIC, sizeof(SAVE_MAGIC));
+    header.version = SAVE_FORMAT_VERSION;
+    header.headerSize = sizeof(SaveHeader);
+    header.level = currentLevel;
+    header.score = player.getScore();
+    header.moves = player.getMoveCount();
+    header.playerX = player.getX();
+    header.playerY = player.getY();
+    header.width = maze.getWidth();
+    header.height = maze.getHeight();
+    maze.getExitPosition(header.exitX, header.exitY);
+    header.flags = gameWon ? SAVE_FLAG_LEVEL_WON : 0;
+    header.enemyCount = enemyCount;
+    header.collectibleCount = collectibleCount;
+
+    std::memcpy(&image[layout.gridOffset], maze.getCells(), static_cast<size_t>(maze.getCellCount()));
+
+    char* cursor = &image[layout.enemyOffset];
+    cursor = writeColumn(enemy.x, cursor);
+    cursor = writeColumn(enemy.y, cursor);
+    cursor = writeColumn(enemy.moveTimer, cursor);
+    cursor = writeColumn(enemy.moveDelay, cursor);
+    writeColumn(enemy.active, cursor);
+
+    cursor = &image[layout.collectibleOffset];
+    cursor = writeColumn(collectible.x, cursor);
+    cursor = writeColumn(collectible.y, cursor);
+    cursor = writeColumn(collectible.pointValue, cursor);
+    writeColumn(collectible.collected, cursor);
+
+    std::memcpy(&image[0], &header, sizeof(header));
+}
+
+/**
+ * Restore the complete game state from a binary save image
+ * The image is validated in full before anything is changed
+ * @param data File contents
+ * @param size File size in bytes
+ * @return true if the image was valid and has been applied
+ */
+bool Game::applySaveImage(const char* data, size_t size) {
+    SaveHeader header;
+    if (size < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, SAVE_MAGIC, sizeof(SAVE_MAGIC)) != 0 ||
+        header.version != SAVE_FORMAT_VERSION || header.headerSize != sizeof(SaveHeader)) {
+        return false;
+    }
+    if (header.width < 4 || header.height < 4 ||
+        header.width > Maze::getMaxSize() || header.height > Maze::getMaxSize()) {
+        return false;
+    }
+    const uint32_t cellCount = static_cast<uint32_t>(header.width) * static_cast<uint32_t>(header.height);
+    if (header.enemyCount > cellCount || header.collectibleCount > cellCount) {
+        return false;
+    }
+
+    const SaveLayout layout = SaveLayout::compute(header.width, header.height, header.enemyCount, header.collectibleCount);
+    if (layout.totalSize != size) {
+        return false;
+    }
+
+    const uint64_t storedChecksum = header.checksum;
+    header.checksum = 0;
+    SaveChecksum checksum;
+    checksum.update(reinterpret_cast<const char*>(&header), sizeof(header));
+    checksum.update(data + sizeof(header), size - sizeof(header));
+    if (checksum.finish() != storedChecksum) {
+        return false;
+    }
+
+    const uint32_t enemyCount = header.enemyCount;
+    const uint32_t collectibleCount = header.collectibleCount;
+    const char* enemyData = data + layout.enemyOffset;
+    const char* collectibleData = data + layout.collectibleOffset;
+    if (header.level < 1 || header.level > MAX_LEVELS ||
+        header.exitX < 0 || header.exitY < 0 || header.exitX >= header.width || header.exitY >= header.height ||
+        header.playerX < 0 || header.playerY < 0 || header.playerX >= header.width || header.playerY >= header.height ||
+        !positionsInside(enemyData, enemyData + enemyCount * 4, enemyCount, header.width, header.height) ||
+        !positionsInside(collectibleData, collectibleData + collectibleCount * 4, collectibleCount, header.width, header.height)) {
+        return false;
+    }
+
+    // The player and the exit must stand on open cells of the saved grid
+    const char* cells = data + layout.gridOffset;
+    if (cells[header.playerY * header.width + header.playerX] == '#' ||
+        cells[header.exitY * header.width + header.exitX] == '#') {
+        return false;
+    }
+
+    // Apply loaded state. The occupancy index is emptied entity by entity while
+    // the old entities are still known, unless the maze size changes anyway.
+    const bool sameSize = header.width == maze.getWidth() && header.height == maze.getHeight();
+    if (sameSize) {
+        unindexEntities();
+    }
+
+    currentLevel = header.level;
+    gameWon = (header.flags & SAVE_FLAG_LEVEL_WON) != 0;
+    gameOver = false;
+    needsRedraw = true;
+
+    maze.assignCells(data + layout.gridOffset, header.width, header.height);
+    chaseField.invalidate();
+    maze.setExitPosition(header.exitX, header.exitY);
+
+    player.setPosition(header.playerX, header.playerY);
+    player.resetStats();
+    player.setScore(header.score);
+    player.setMoveCount(header.moves);
+
+    // Start from an empty store so the columns are laid out afresh in its arena
+    // rather than abandoning their old blocks there until the next level
+    entities.clear();
+    entities.reserve(static_cast<int>(enemyCount), static_cast<int>(collectibleCount));
+
+    EnemyColumns& enemy = entities.enemies();
+    readColumn(enemy.x, enemyData, enemyCount);
+    readColumn(enemy.y, enemyData + enemyCount * 4, enemyCount);
+    readColumn(enemy.moveTimer, enemyData + enemyCount * 8, enemyCount);
+    readColumn(enemy.moveDelay, enemyData + enemyCount * 12, enemyCount);
+    readColumn(enemy.active, enemyData + enemyCount * 16, enemyCount);
+
+    CollectibleColumns& collectible = entities.collectibles();
+    readColumn(collectible.x, collectibleData, collectibleCount);
+    readColumn(collectible.y, collectibleData + collectibleCount * 4, collectibleCount);
+    readColumn(collectible.pointValue, collectibleData + collectibleCount * 8, collectibleCount);
+    readColumn(collectible.collected, collectibleData + collectibleCount * 12, collectibleCount);
+
+    if (sameSize) {
+        occupancy.resizeCollectibles(static_cast<int>(collectibleCount));
+    } else {
+        occupancy.reset(header.width, header.height, static_cast<int>(collectibleCount));
+    }
+    indexEntities();
+    return true;
+}
+
+/**
+ * Restore game state from a text save (MAZEGAME_SAVE_V1)
+ * Text saves hold no entity state, so enemies and collectibles are
+ * generated afresh for the saved level
+ * @param data File contents
+ * @param size File size in bytes
+ * @return true if the save was valid and has been applied
+ */
+bool Game::applyTextSave(const char* data, size_t size) {
+    std::istringstream file(std::string(data, size));
+
     std::string fileFormat;
     file >> fileFormat;
 
     if (fileFormat != "MAZEGAME_SAVE_V1") {
         std::cout << "Invalid save file format!" << std::endl;
-        file.close();
-        return;
+        return false;
     }
 
     // Load game state
     int savedLevel, savedScore, savedMoves, playerX, playerY;
     file >> savedLevel >> savedScore >> savedMoves >> playerX >> playerY;
+    if (!file || savedLevel < 1 || savedLevel > MAX_LEVELS) {
+        std::cout << "Invalid game state in save file!" << std::endl;
+        return false;
+    }
 
-    // Load maze layout
-    char loadedMaze[10][10];
+    // Load maze layout - rows always start with a border wall, so reading
+    // stops at the exit coordinates that follow the last row
+    std::vector<std::string> rows;
     std::string line;
     std::getline(file, line); // consume newline after coordinates
 
-    for (int i = 0; i < 10; i++) {
-        std::getline(file, line);
-        if (line.length() >= 10) {
-            for (int j = 0; j < 10; j++) {
-                loadedMaze[i][j] = line[j];
-            }
+    while (std::getline(file, line) && !line.empty() && line[0] == '#') {
+        if (line.back() == '\r') {
+            line.pop_back();
         }
+        rows.push_back(line);
     }
 
-    // Load exit position
-    int exitX, exitY;
-    file >> exitX >> exitY;
-    file.close();
+    // Load exit position (the loop above already consumed its line)
+    int exitX = 0, exitY = 0;
+    std::istringstream exitLine(line);
+    const bool exitRead = static_cast<bool>(exitLine >> exitX >> exitY);
+
+    const int loadedHeight = static_cast<int>(rows.size());
+    const int loadedWidth = rows.empty() ? 0 : static_cast<int>(rows[0].length());
+    if (loadedWidth < 4 || loadedHeight < 4 ||
+        loadedWidth > Maze::getMaxSize() || loadedHeight > Maze::getMaxSize()) {
+        std::cout << "Invalid maze layout in save file!" << std::endl;
+        return false;
+    }
+
+    // The player must stand on an open cell of the saved maze (short rows are padded with walls)
+    if (playerX < 0 || playerY < 0 || playerX >= loadedWidth || playerY >= loadedHeight ||
+        playerX >= static_cast<int>(rows[playerY].length()) || rows[playerY][playerX] == '#') {
+        std::cout << "Invalid player position in save file!" << std::endl;
+        return false;
+    }
+    if (!exitRead || exitX < 0 || exitY < 0 || exitX >= loadedWidth || exitY >= loadedHeight) {
+        std::cout << "Invalid exit position in save file!" << std::endl;
+        return false;
+    }
 
     // Apply loaded state
     currentLevel = savedLevel;
 
     // Update maze with loaded layout
-    for (int i = 0; i < 10; i++) {
-        for (int j = 0; j < 10; j++) {
-            maze.setCell(j, i, loadedMaze[i][j]);
+    if (loadedWidth != maze.getWidth() || loadedHeight != maze.getHeight()) {
+        maze.resize(loadedWidth, loadedHeight);
+    }
+    for (int i = 0; i < loadedHeight; i++) {
+        const std::string& row = rows[i];
+        for (int j = 0; j < loadedWidth; j++) {
+            maze.setCell(j, i, j < static_cast<int>(row.length()) ? row[j] : '#');
         }
     }
+    maze.setExitPosition(exitX, exitY);
+    chaseField.invalidate();
 
     // Set player position and stats
     player.setPosition(playerX, playerY);
@@ -555,53 +1319,40 @@ void Game::loadGameFromSlot(int slot) {
     player.setScore(savedScore);
     player.setMoveCount(savedMoves);
 
-    // Clear and regenerate entities for current level
-    enemies.clear();
-    collectibles.clear();
-
     // Regenerate enemies and collectibles based on current level
-    int enemyCount = std::min(currentLevel, 3);
-    for (int i = 0; i < enemyCount; i++) {
-        int x, y;
-        do {
-            x = rand() % 8 + 1;
-            y = rand() % 8 + 1;
-        } while (maze.isWall(x, y) || (x == playerX && y == playerY) || maze.isExit(x, y));
-
-        enemies.push_back(std::unique_ptr<Enemy>(new Enemy(x, y, 3 + currentLevel)));
-    }
-
-    int collectibleCount = 3 + currentLevel;
-    for (int i = 0; i < collectibleCount; i++) {
-        int x, y;
-        do {
-            x = rand() % 8 + 1;
-            y = rand() % 8 + 1;
-        } while (maze.isWall(x, y) || (x == playerX && y == playerY) || maze.isExit(x, y));
-
-        collectibles.push_back(std::unique_ptr<Collectible>(new Collectible(x, y, 10 * currentLevel)));
+    const int enemyCount = std::min(currentLevel, 3);
+    const int collectibleCount = 3 + currentLevel;
+    if (!spawnEntities(enemyCount, collectibleCount)) {
+        saveStatus = "Not enough open cells: placed " + std::to_string(entities.getEnemyCount()) + " of " +
+                     std::to_string(enemyCount) + " enemies and " + std::to_string(entities.getCollectibleCount()) +
+                     " of " + std::to_string(collectibleCount) + " collectibles";
+        needsRedraw = true;
     }
-
-    std::cout << "Complete game state loaded from slot " << slot << " successfully!" << std::endl;
-    std::cout << "Level: " << currentLevel << " | Score: " << savedScore << " | Moves: " << savedMoves << std::endl;
+    return true;
 }
 
 /**
  * Wait for any key press - works on both Windows and Unix
  */
-void Game::waitForKeyPress() const {
-#ifdef _WIN32
-    _getch(); // Windows - simple key press
-#else
-    // Unix/Linux - more complex but reliable
-    struct termios oldt, newt;
-    tcgetattr(STDIN_FILENO, &oldt);
-    newt = oldt;
-    newt.c_lflag &= ~(ICANON | ECHO);
-    tcsetattr(STDIN_FILENO, TCSANOW, &newt);
-    getchar();
-    tcsetattr(STDIN_FILENO, TCSANOW, &oldt);
-#endif
+void Game::waitForKeyPress() {
+    input.readKey();
+}
+
+/**
+ * Read a menu choice: the next key that is not whitespace
+ * The key is echoed, since the terminal itself no longer echoes
+ * @return Chosen key, or 0 if input was closed
+ */
+char Game::readMenuChoice() {
+    char key;
+    do {
+        key = input.readKey();
+    } while (key == ' ' || key == '\n' || key == '\r' || key == '\t');
+
+    if (key) {
+        std::cout << key << std::endl;
+    }
+    return key;
 }
 
 /**
@@ -616,8 +1367,7 @@ bool Game::showStartupMenu() {
     std::cout << std::endl;
     std::cout << "Choose an option (1-3): ";
 
-    char choice;
-    std::cin >> choice;
+    char choice = readMenuChoice();
 
     switch (choice) {
         case '1':
@@ -627,7 +1377,7 @@ bool Game::showStartupMenu() {
             std::cout << "=== LOAD GAME ===" << std::endl;
             std::cout << "Choose save slot (1-5): ";
             char slot;
-            std::cin >> slot;
+            slot = readMenuChoice();
             if (slot >= '1' && slot <= '5') {
                 loadGameFromSlot(slot - '0');
             } else {
@@ -652,11 +1402,10 @@ void Game::displaySaveMenu() {
     std::cout << "=== SAVE GAME ===" << std::endl;
     std::cout << "Choose save slot (1-5): ";
 
-    char slot;
-    std::cin >> slot;
+    char slot = readMenuChoice();
 
     if (slot >= '1' && slot <= '5') {
-        saveGameToSlot(slot - '0');
+        queueSaveToSlot(slot - '0');
     } else {
         std::cout << "Invalid slot!" << std::endl;
         }
@@ -673,8 +1422,7 @@ void Game::displayLoadMenu() {
     std::cout << "=== LOAD GAME ===" << std::endl;
     std::cout << "Choose save slot (1-5): ";
 
-    char slot;
-    std::cin >> slot;
+    char slot = readMenuChoice();
 
     if (slot >= '1' && slot <= '5') {
         loadGameFromSlot(slot - '0');
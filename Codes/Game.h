@@ -3,10 +3,44 @@
 
 #include "Maze.h"
 #include "Player.h"
-#include "Enemy.h"
-#include "Collectible.h"
+#include "EntityStore.h"
+#include "OccupancyGrid.h"
+#include "TerminalRenderer.h"
+#include "TerminalInput.h"
+#include "TickScheduler.h"
+#include "SaveWriter.h"
+#include "LevelPregenerator.h"
+#include "FlowField.h"
+#include "Random.h"
+#include "Camera.h"
+#include "InputLog.h"
 #include <vector>
-#include <memory>
+#include <string>
+
+/**
+ * Player actions understood by the game logic
+ * Decoupled from the keys that produce them so the game can run headless
+ */
+enum class InputAction {
+    None,
+    MoveUp,
+    MoveDown,
+    MoveLeft,
+    MoveRight,
+    Quit,
+    Restart,
+    NextLevel,
+    SaveMenu,
+    LoadMenu
+};
+
+/**
+ * How enemies choose where to move
+ */
+enum class EnemyBehavior {
+    Wander,  // Random direction each move
+    Chase    // Step along the shortest path towards the player
+};
 
 /**
  * Game class managing overall game state and logic
@@ -16,38 +50,93 @@ class Game {
 private:
     Maze maze;
     Player player;
-    std::vector<std::unique_ptr<Enemy>> enemies;
-    std::vector<std::unique_ptr<Collectible>> collectibles;
+    EntityStore entities;     // Enemies and collectibles, stored column by column
+    OccupancyGrid occupancy;  // Which entities stand on each cell
+    LevelPregenerator pregenerator;  // Builds the next level in the background
+    FlowField chaseField;     // Distances to the player, shared by chasing enemies
+    EnemyBehavior enemyBehavior;
+    MazeAlgorithm mazeAlgorithm;     // Layout of generated levels
+    uint64_t seed;                   // Game seed: the same seed plays out the same game
+    Random placementRandom;          // Entity placement for spawnEntities
+    Random enemyRandom;              // Wandering enemy moves, reseeded per level
+
+    // Rendering
+    TerminalRenderer renderer;              // Sends only what changed between frames
+    TerminalInput input;                    // Raw-mode keyboard queue for the session
+    TickScheduler scheduler;                // Fixed-timestep pacing for the main loop
+    Camera camera;                          // Window of the maze shown on screen
+    int terminalColumns;                    // Terminal width the camera was last fitted to
+    std::vector<char> displayGrid;          // Composed cells, reused every frame
+    std::vector<std::string> statusLines;   // Composed status lines, reused every frame
+
+    // Input recording
+    InputLog inputLog;                      // Session being recorded
+    bool recordingInput;                    // Whether actions go into inputLog
+    uint32_t tickCount;                     // Simulation ticks since the game (or recording) started
+
+    // Background saving
+    SaveWriter saveWriter;                  // Writes save files off the game loop
+    std::string saveStatus;                 // Outcome of the last background save or load, if any
 
     int currentLevel;
     bool gameRunning;
     bool gameWon;
     bool gameOver;
     bool needsRedraw;
+    bool pregenerateLevels;
 
     // Game constants
     static const int MAX_LEVELS = 5;
+    static const int DEFAULT_TICK_INTERVAL_MS = 120;
+    static const int DEFAULT_MAX_CATCH_UP_TICKS = 5;
+    static const int MAX_STATUS_LINES = 7;           // Most lines composeStatus returns
+    static const int STATUS_ROWS = MAX_STATUS_LINES + 2;  // Rows kept below the maze: separator, status, cursor
+    static const int DEFAULT_TERMINAL_COLUMNS = 80;  // Assumed when the terminal size is unknown
+    static const int DEFAULT_TERMINAL_ROWS = 24;
 
 public:
     // Constructor
-    Game();
+    Game(int mazeWidth = Maze::getDefaultSize(), int mazeHeight = Maze::getDefaultSize(),
+         uint64_t gameSeed = Random::seedFromClock());
+    Game(int mazeWidth, int mazeHeight, uint64_t gameSeed, int startLevel, MazeAlgorithm algorithm);
 
     // Destructor
     ~Game() = default;
 
     // Game loop
     void run();
+    bool step(InputAction action);
+    bool applyPlayerAction(InputAction action);
     void update();
     void render();
+    void composeFrame(std::string& frame) const;
+    void composeDisplay(std::vector<char>& grid) const;
+    void composeDisplay(char* grid) const;
+    void composeWindow(char* grid, int left, int top, int width, int height) const;
+    void composeStatus(std::vector<std::string>& lines) const;
 
     // Input handling
-    void handleInput();
-    char getInput() const;
+    void handleInput(InputAction action);
+    InputAction pollInput();
+    char getInput();
+    static InputAction actionFromKey(char key);
 
     // Game state management
     void initializeLevel(int level);
+    bool spawnEntities(int enemyCount, int collectibleCount);
+    LevelSpec levelSpec(int level) const;
+    static void buildLevel(const LevelSpec& spec, Maze& levelMaze, EntityStore& levelEntities,
+                           OccupancyGrid& levelOccupancy);
+    static bool placeEntities(const Maze& levelMaze, int playerX, int playerY, int level,
+                              int enemyCount, int collectibleCount, Random& random,
+                              EntityStore& levelEntities, OccupancyGrid& levelOccupancy);
+    void requestNextLevel();
+    void setLevelPregeneration(bool enabled);
+    void indexEntities();
+    void unindexEntities();
     void nextLevel();
     void resetGame();
+    void newGame(uint64_t gameSeed);
     void checkGameOver();
     void checkWinCondition();
 
@@ -61,7 +150,7 @@ public:
     bool isValidPlayerMove(int newX, int newY) const;
 
     // Display
-    void displayMenu() const;
+    void displayMenu();
     void displaySaveMenu();
     void displayLoadMenu();
     bool showStartupMenu();
@@ -69,13 +158,49 @@ public:
     // File operations
     void saveGame() const;
     void saveGameToSlot(int slot) const;
+    void queueSaveToSlot(int slot);
+    void collectSaveResults();
+    static std::string slotFilename(int slot);
     void loadGame();
     void loadGameFromSlot(int slot);
-    void waitForKeyPress() const;
+    void buildSaveImage(std::vector<char>& image) const;
+    void snapshotSaveImage(std::vector<char>& image) const;
+    bool applySaveImage(const char* data, size_t size);
+    bool applyTextSave(const char* data, size_t size);
+    void waitForKeyPress();
+    char readMenuChoice();
+
+    // Enemy behaviour
+    void setEnemyBehavior(EnemyBehavior behavior) { enemyBehavior = behavior; }
+    EnemyBehavior getEnemyBehavior() const { return enemyBehavior; }
+
+    // Recording and replay
+    void startRecording();
+    bool finishRecording(InputLog& log);
+    bool isRecording() const { return recordingInput; }
+    ReplayOutcome captureOutcome() const;
+    static bool replayLog(const InputLog& log, ReplayOutcome& outcome);
+    uint32_t getTickCount() const { return tickCount; }
+
+    // Level layout
+    void setMazeAlgorithm(MazeAlgorithm algorithm);
+    MazeAlgorithm getMazeAlgorithm() const { return mazeAlgorithm; }
+    uint64_t getSeed() const { return seed; }
+
+    // Loop timing
+    void setTickRate(double ticksPerSecond) { scheduler.setTickRate(ticksPerSecond); }
+    void setMaxCatchUpTicks(int ticks) { scheduler.setMaxCatchUpTicks(ticks); }
+    double getTickRate() const { return scheduler.getTickRate(); }
 
     // Utility
     bool isGameRunning() const { return gameRunning; }
+    bool isGameOver() const { return gameOver; }
+    bool isLevelWon() const { return gameWon; }
     int getCurrentLevel() const { return currentLevel; }
+    const Maze& getMaze() const { return maze; }
+    const Player& getPlayer() const { return player; }
+    const EntityStore& getEntities() const { return entities; }
+    const OccupancyGrid& getOccupancy() const { return occupancy; }
 };
 
 #endif // GAME_H
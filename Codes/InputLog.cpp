@@ -0,0 +1,164 @@
+#include "InputLog.h"
+#include "MappedFile.h"
+#include "SaveFormat.h"
+#include <iostream>
+#include <fstream>
+#include <cstring>
+
+/**
+ * Constructor for InputLog class
+ * The log is empty until begin is called
+ */
+InputLog::InputLog() : lastTick(0) {
+    begin(0, 0, 0, 0, 0);
+}
+
+/**
+ * Start a new recording, discarding any previous one
+ * @param seed Game seed
+ * @param width Maze width in cells
+ * @param height Maze height in cells
+ * @param mazeAlgorithm MazeAlgorithm value the game uses
+ * @param enemyBehavior EnemyBehavior value the game uses
+ */
+void InputLog::begin(uint64_t seed, int width, int height, uint8_t mazeAlgorithm, uint8_t enemyBehavior) {
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, INPUT_LOG_MAGIC, sizeof(INPUT_LOG_MAGIC));
+    header.version = INPUT_LOG_FORMAT_VERSION;
+    header.headerSize = sizeof(InputLogHeader);
+    header.seed = seed;
+    header.width = width;
+    header.height = height;
+    header.mazeAlgorithm = mazeAlgorithm;
+    header.enemyBehavior = enemyBehavior;
+    events.clear();
+    lastTick = 0;
+}
+
+/**
+ * Record one player action
+ * @param tick Simulation tick it was applied on (never less than the last one)
+ * @param action InputAction value (below 16)
+ * @param stepped Whether it was passed to Game::step rather than applied between ticks
+ */
+void InputLog::append(uint32_t tick, uint8_t action, bool stepped) {
+    uint64_t value = (static_cast<uint64_t>(tick - lastTick) << 5) | (stepped ? 16u : 0u) | (action & 15u);
+    while (value >= 0x80) {
+        events.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    events.push_back(static_cast<uint8_t>(value));
+    lastTick = tick;
+    header.eventCount++;
+    header.eventBytes = events.size();
+}
+
+/**
+ * Store the state the recorded game ended in
+ * @param outcome Final state, checked by replays
+ */
+void InputLog::finish(const ReplayOutcome& outcome) {
+    header.outcome = outcome;
+    header.outcome.reserved = 0;
+}
+
+/**
+ * Decode the next event
+ * Start with offset 0 and event.tick 0; each call continues from the
+ * previous event's offset and tick
+ * @param offset Byte offset of the next event, advanced past it
+ * @param event Previous event on entry, next event on return
+ * @return false when there are no more events (or the data is cut short)
+ */
+bool InputLog::nextEvent(size_t& offset, InputEvent& event) const {
+    uint64_t value = 0;
+    for (int shift = 0; ; shift += 7) {
+        if (offset >= events.size() || shift > 35) {
+            return false;
+        }
+        const uint8_t byte = events[offset++];
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            break;
+        }
+    }
+    event.tick += static_cast<uint32_t>(value >> 5);
+    event.stepped = (value & 16) != 0;
+    event.action = static_cast<uint8_t>(value & 15);
+    return true;
+}
+
+/**
+ * Write the recording to a file
+ * @param filename File to write
+ * @return true if successful
+ */
+bool InputLog::saveToFile(const std::string& filename) const {
+    // Events are padded to whole 8-byte words for the checksum
+    std::vector<char> body((events.size() + 7) & ~static_cast<size_t>(7), 0);
+    if (!events.empty()) {
+        std::memcpy(body.data(), events.data(), events.size());
+    }
+
+    InputLogHeader sealed = header;
+    sealed.checksum = 0;
+    SaveChecksum checksum;
+    checksum.update(reinterpret_cast<const char*>(&sealed), sizeof(sealed));
+    checksum.update(body.data(), body.size());
+    sealed.checksum = checksum.finish();
+
+    std::ofstream file(filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cout << "Could not write recording " << filename << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&sealed), sizeof(sealed));
+    file.write(body.data(), static_cast<std::streamsize>(body.size()));
+    return file.good();
+}
+
+/**
+ * Read a recording written by saveToFile
+ * The file is validated completely before anything is replaced
+ * @param filename File to read
+ * @return true if successful
+ */
+bool InputLog::loadFromFile(const std::string& filename) {
+    MappedFile file;
+    if (!file.open(filename)) {
+        std::cout << "Could not open recording " << filename << std::endl;
+        return false;
+    }
+
+    InputLogHeader loaded;
+    if (file.size() < sizeof(loaded)) {
+        std::cout << "Recording " << filename << " is too short!" << std::endl;
+        return false;
+    }
+    std::memcpy(&loaded, file.data(), sizeof(loaded));
+
+    const uint64_t paddedBytes = (loaded.eventBytes + 7) & ~static_cast<uint64_t>(7);
+    if (std::memcmp(loaded.magic, INPUT_LOG_MAGIC, sizeof(INPUT_LOG_MAGIC)) != 0 ||
+        loaded.version != INPUT_LOG_FORMAT_VERSION || loaded.headerSize != sizeof(InputLogHeader) ||
+        loaded.eventBytes > file.size() || file.size() != sizeof(loaded) + paddedBytes) {
+        std::cout << "Recording " << filename << " is not a valid input log!" << std::endl;
+        return false;
+    }
+
+    const uint64_t storedChecksum = loaded.checksum;
+    loaded.checksum = 0;
+    SaveChecksum checksum;
+    checksum.update(reinterpret_cast<const char*>(&loaded), sizeof(loaded));
+    checksum.update(file.data() + sizeof(loaded), static_cast<size_t>(paddedBytes));
+    if (checksum.finish() != storedChecksum) {
+        std::cout << "Recording " << filename << " is damaged!" << std::endl;
+        return false;
+    }
+
+    header = loaded;
+    header.checksum = 0;
+    const uint8_t* source = reinterpret_cast<const uint8_t*>(file.data() + sizeof(loaded));
+    events.assign(source, source + loaded.eventBytes);
+    lastTick = 0;  // Only meaningful while recording
+    return true;
+}
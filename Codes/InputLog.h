@@ -0,0 +1,119 @@
+#ifndef INPUTLOG_H
+#define INPUTLOG_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Recorded input file layout (format version 1)
+ *
+ *   InputLogHeader                 fixed size, see below
+ *   events                         eventBytes bytes, zero-padded to a multiple of 8
+ *
+ * Each event is one unsigned LEB128 varint holding
+ * (ticks since the previous event << 5) | (stepped << 4) | action,
+ * so a key press costs a single byte in the common case. Integers in the
+ * header are stored in the machine's native byte order. The checksum
+ * covers the header (with the checksum field zeroed) and the events.
+ */
+
+/**
+ * State of a game at the end of a recording, compared after a replay
+ */
+struct ReplayOutcome {
+    uint64_t enemyHash;         // Hash of every active enemy's position
+    uint32_t ticks;             // Simulation ticks run
+    int32_t level;
+    int32_t score;
+    int32_t moves;
+    int32_t playerX, playerY;
+    uint32_t flags;             // REPLAY_FLAG_* bits
+    uint32_t reserved;          // Zero
+
+    bool operator==(const ReplayOutcome& other) const {
+        return enemyHash == other.enemyHash && ticks == other.ticks && level == other.level &&
+               score == other.score && moves == other.moves && playerX == other.playerX &&
+               playerY == other.playerY && flags == other.flags;
+    }
+    bool operator!=(const ReplayOutcome& other) const { return !(*this == other); }
+};
+
+const uint32_t REPLAY_FLAG_RUNNING = 1;
+const uint32_t REPLAY_FLAG_LEVEL_WON = 2;
+const uint32_t REPLAY_FLAG_GAME_OVER = 4;
+
+/**
+ * Fixed header at the start of a recorded input file
+ */
+struct InputLogHeader {
+    char magic[8];              // INPUT_LOG_MAGIC
+    uint32_t version;           // INPUT_LOG_FORMAT_VERSION
+    uint32_t headerSize;        // sizeof(InputLogHeader)
+    uint64_t seed;              // Game seed
+    int32_t width, height;      // Maze size in cells
+    uint8_t mazeAlgorithm;      // MazeAlgorithm the game was set to
+    uint8_t enemyBehavior;      // EnemyBehavior the game was set to
+    uint8_t reserved[2];        // Zero
+    uint32_t eventCount;
+    uint64_t eventBytes;        // Encoded event bytes, before padding
+    ReplayOutcome outcome;
+    uint64_t checksum;
+};
+
+static_assert(sizeof(ReplayOutcome) == 40, "ReplayOutcome is copied to and from disk as is");
+static_assert(sizeof(InputLogHeader) == 96, "InputLogHeader is copied to and from disk as is");
+
+const char INPUT_LOG_MAGIC[8] = {'M', 'A', 'Z', 'E', 'R', 'E', 'C', '1'};
+const uint32_t INPUT_LOG_FORMAT_VERSION = 1;
+
+/**
+ * One recorded player action
+ */
+struct InputEvent {
+    uint32_t tick;              // Simulation tick the action was applied on
+    uint8_t action;             // InputAction value
+    bool stepped;               // Passed to Game::step (else applied between ticks)
+};
+
+/**
+ * InputLog class holding a recorded session: the seed and settings the
+ * game started from, every player action stamped with its tick, and the
+ * outcome the game reached. Replaying the actions into a game built from
+ * the same seed and settings reproduces the session exactly.
+ */
+class InputLog {
+private:
+    InputLogHeader header;      // Settings, counts and outcome
+    std::vector<uint8_t> events;// Encoded events
+    uint32_t lastTick;          // Tick of the most recent event
+
+public:
+    // Constructor
+    InputLog();
+
+    // Recording
+    void begin(uint64_t seed, int width, int height, uint8_t mazeAlgorithm, uint8_t enemyBehavior);
+    void append(uint32_t tick, uint8_t action, bool stepped);
+    void finish(const ReplayOutcome& outcome);
+
+    // Playback
+    bool nextEvent(size_t& offset, InputEvent& event) const;
+
+    // File I/O
+    bool saveToFile(const std::string& filename) const;
+    bool loadFromFile(const std::string& filename);
+
+    // Getters
+    uint64_t getSeed() const { return header.seed; }
+    int getWidth() const { return header.width; }
+    int getHeight() const { return header.height; }
+    uint8_t getMazeAlgorithm() const { return header.mazeAlgorithm; }
+    uint8_t getEnemyBehavior() const { return header.enemyBehavior; }
+    uint32_t getEventCount() const { return header.eventCount; }
+    size_t getEventBytes() const { return events.size(); }
+    const ReplayOutcome& getOutcome() const { return header.outcome; }
+};
+
+#endif // INPUTLOG_H
@@ -0,0 +1,86 @@
+#include "LevelArena.h"
+#include <cstdlib>
+
+const size_t LevelArena::DEFAULT_CAPACITY;
+
+/**
+ * Constructor for LevelArena class
+ * The main block is obtained on first use
+ * @param initialCapacity Size of the main block in bytes
+ */
+LevelArena::LevelArena(size_t initialCapacity)
+    : block(nullptr), capacity(initialCapacity), used(0), overflow(nullptr), overflowBytes(0),
+      systemAllocations(0) {
+}
+
+/**
+ * Destructor for LevelArena class
+ */
+LevelArena::~LevelArena() {
+    releaseOverflow();
+    std::free(block);
+}
+
+/**
+ * Hand out memory that lives until the next reset
+ * @param bytes Size wanted
+ * @param alignment Alignment wanted (a power of two, at most that of max_align_t)
+ * @return Pointer to the memory
+ */
+void* LevelArena::allocate(size_t bytes, size_t alignment) {
+    if (block == nullptr && capacity > 0) {
+        block = static_cast<char*>(std::malloc(capacity));
+        if (block == nullptr) {
+            throw std::bad_alloc();
+        }
+        systemAllocations++;
+    }
+
+    const size_t offset = (used + alignment - 1) & ~(alignment - 1);
+    if (block != nullptr && offset <= capacity && bytes <= capacity - offset) {
+        used = offset + bytes;
+        return block + offset;
+    }
+
+    // Main block is full: give this allocation a block of its own until reset.
+    // The header keeps the list link and leaves the payload max_align_t aligned.
+    const size_t header = alignof(std::max_align_t) > sizeof(void*) ? alignof(std::max_align_t) : sizeof(void*);
+    char* extra = static_cast<char*>(std::malloc(header + bytes));
+    if (extra == nullptr) {
+        throw std::bad_alloc();
+    }
+    systemAllocations++;
+    *reinterpret_cast<void**>(extra) = overflow;
+    overflow = extra;
+    overflowBytes += bytes + alignment;
+    return extra + header;
+}
+
+/**
+ * Release everything handed out since the last reset
+ * Nothing allocated from the arena may be used afterwards. If the level
+ * outgrew the main block, the block is replaced by one that would have
+ * held the whole level.
+ */
+void LevelArena::reset() {
+    if (overflow != nullptr) {
+        releaseOverflow();
+        const size_t needed = used + overflowBytes;
+        std::free(block);
+        block = nullptr;              // Obtained again, at the new size, on first use
+        capacity = needed + needed / 4;
+    }
+    used = 0;
+    overflowBytes = 0;
+}
+
+/**
+ * Return every extra block to the system
+ */
+void LevelArena::releaseOverflow() {
+    while (overflow != nullptr) {
+        void* next = *static_cast<void**>(overflow);
+        std::free(overflow);
+        overflow = next;
+    }
+}
@@ -0,0 +1,94 @@
+#ifndef LEVELARENA_H
+#define LEVELARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+/**
+ * LevelArena class handing out memory for one level's data from a single block
+ * Allocation bumps an offset and freeing individual allocations does
+ * nothing; everything is released at once by reset when the level ends.
+ * A level that needs more than the block holds gets extra blocks for the
+ * rest of the level, and reset then replaces them all with one block big
+ * enough for that level, so after the largest level has been seen once a
+ * level transition costs no system allocations at all.
+ */
+class LevelArena {
+private:
+    char* block;                // Main block, capacity bytes
+    size_t capacity;
+    size_t used;                // Bytes of the main block handed out
+    void* overflow;             // Extra blocks of this level, linked through their first word
+    size_t overflowBytes;       // Bytes requested from extra blocks this level
+    uint64_t systemAllocations; // Blocks obtained from the system so far
+
+    static const size_t DEFAULT_CAPACITY = 4096;
+
+    void releaseOverflow();
+
+public:
+    // Constructor
+    explicit LevelArena(size_t initialCapacity = DEFAULT_CAPACITY);
+
+    // Destructor
+    ~LevelArena();
+
+    // Not copyable: owns its blocks
+    LevelArena(const LevelArena&) = delete;
+    LevelArena& operator=(const LevelArena&) = delete;
+
+    // Allocation
+    void* allocate(size_t bytes, size_t alignment);
+    void reset();
+
+    // Getters
+    size_t getCapacity() const { return capacity; }
+    size_t getUsed() const { return used + overflowBytes; }
+    uint64_t getSystemAllocations() const { return systemAllocations; }
+};
+
+/**
+ * Standard allocator drawing from a LevelArena
+ * Deallocation is a no-op; the arena is reset as a whole. The allocator
+ * travels with a container on move and swap, so containers can be
+ * exchanged together with the arena that owns their storage. A
+ * default-constructed allocator has no arena and uses the global heap.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    typedef T value_type;
+    typedef std::true_type propagate_on_container_copy_assignment;
+    typedef std::true_type propagate_on_container_move_assignment;
+    typedef std::true_type propagate_on_container_swap;
+
+    LevelArena* arena;
+
+    ArenaAllocator() noexcept : arena(nullptr) {}
+    explicit ArenaAllocator(LevelArena* levelArena) noexcept : arena(levelArena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.arena) {}
+
+    T* allocate(size_t count) {
+        if (arena == nullptr) {
+            return static_cast<T*>(::operator new(count * sizeof(T)));
+        }
+        return static_cast<T*>(arena->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* pointer, size_t) noexcept {
+        if (arena == nullptr) {
+            ::operator delete(pointer);
+        }
+    }
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.arena == b.arena; }
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.arena != b.arena; }
+
+#endif // LEVELARENA_H
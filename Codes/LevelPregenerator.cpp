@@ -0,0 +1,128 @@
+#include "LevelPregenerator.h"
+
+/**
+ * Constructor for LevelPregenerator class
+ * No thread is started until the first request
+ * @param levelBuilder Function that builds a level
+ */
+LevelPregenerator::LevelPregenerator(LevelBuilder levelBuilder)
+    : builder(levelBuilder), state(State::Idle), requestPending(false), discardCurrent(false),
+      stopping(false) {
+    const LevelSpec none = {0, 0, 0, MazeAlgorithm::ScatteredWalls, 0};
+    requestSpec = none;
+    workSpec = none;
+}
+
+/**
+ * Destructor for LevelPregenerator class
+ */
+LevelPregenerator::~LevelPregenerator() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+        requestPending = false;
+        discardCurrent = true;
+    }
+    wakeWorker.notify_one();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+/**
+ * Start building a level in the background
+ * Anything previously requested is dropped unless it is this same level
+ * @param spec Level to build
+ */
+void LevelPregenerator::request(const LevelSpec& spec) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (state != State::Idle && !discardCurrent && workSpec == spec) {
+            requestPending = false; // Already building or built
+            return;
+        }
+
+        if (state == State::Working) {
+            discardCurrent = true;  // Let it finish, then throw it away
+        } else {
+            state = State::Idle;
+        }
+        requestPending = true;
+        requestSpec = spec;
+
+        if (!worker.joinable()) {
+            worker = std::thread(&LevelPregenerator::workerLoop, this);
+        }
+    }
+    wakeWorker.notify_one();
+}
+
+/**
+ * Drop any queued, in-progress or ready level
+ * An in-progress level cannot be interrupted; it is discarded when done
+ */
+void LevelPregenerator::cancel() {
+    std::lock_guard<std::mutex> lock(mutex);
+    requestPending = false;
+    if (state == State::Working) {
+        discardCurrent = true;
+    } else {
+        state = State::Idle;
+    }
+}
+
+/**
+ * Swap a prepared level into the caller's objects
+ * If the level is still being built this waits for it, which is never
+ * slower than building it again. The caller's old contents are kept as
+ * storage for the next level.
+ * @param spec Level wanted (the size must match targetMaze)
+ * @param targetMaze Receives the maze
+ * @param targetEntities Receives the entities
+ * @param targetOccupancy Receives the entity index
+ * @return true if the level was taken; false means build it directly
+ */
+bool LevelPregenerator::take(const LevelSpec& spec, Maze& targetMaze, EntityStore& targetEntities, OccupancyGrid& targetOccupancy) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (!(workSpec == spec) || spec.width != targetMaze.getWidth() || spec.height != targetMaze.getHeight() ||
+        discardCurrent) {
+        return false;
+    }
+    jobDone.wait(lock, [this]() { return state != State::Working; });
+    if (state != State::Ready) {
+        return false;
+    }
+
+    targetMaze.swap(maze);
+    targetEntities.swap(entities);
+    targetOccupancy.swap(occupancy);
+    state = State::Idle;
+    return true;
+}
+
+/**
+ * Worker thread: build requested levels until shutdown
+ */
+void LevelPregenerator::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wakeWorker.wait(lock, [this]() { return stopping || (requestPending && state != State::Working); });
+        if (stopping) {
+            return;
+        }
+
+        requestPending = false;
+        discardCurrent = false;
+        workSpec = requestSpec;
+        const LevelSpec spec = workSpec;  // Private copy for use outside the lock
+        state = State::Working;
+        lock.unlock();
+
+        builder(spec, maze, entities, occupancy);
+
+        lock.lock();
+        state = discardCurrent ? State::Idle : State::Ready;
+        discardCurrent = false;
+        jobDone.notify_all();
+    }
+}
@@ -0,0 +1,88 @@
+#ifndef LEVELPREGENERATOR_H
+#define LEVELPREGENERATOR_H
+
+#include "Maze.h"
+#include "EntityStore.h"
+#include "OccupancyGrid.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * Everything that determines a generated level
+ * Two equal specs always build identical levels
+ */
+struct LevelSpec {
+    int level;
+    int width, height;        // Maze size in cells
+    MazeAlgorithm algorithm;  // Maze layout
+    uint64_t seed;            // Game seed; the level derives its own random streams from it
+
+    bool operator==(const LevelSpec& other) const {
+        return level == other.level && width == other.width && height == other.height &&
+               algorithm == other.algorithm && seed == other.seed;
+    }
+};
+
+/**
+ * Function that builds a complete level: maze, entities and their index
+ * Must only touch the objects it is given, since it runs on a worker thread
+ */
+typedef void (*LevelBuilder)(const LevelSpec& spec, Maze& maze, EntityStore& entities, OccupancyGrid& occupancy);
+
+/**
+ * LevelPregenerator class building the next level on a worker thread
+ * While one level is played the next is generated in the background, so
+ * advancing only has to swap buffers. Holds at most one level: requesting
+ * another one, or cancelling, discards whatever is queued, in progress or
+ * ready.
+ */
+class LevelPregenerator {
+private:
+    /**
+     * Progress of the level being prepared
+     */
+    enum class State {
+        Idle,      // Nothing prepared
+        Working,   // Worker is building workLevel
+        Ready      // Built level is waiting to be taken
+    };
+
+    LevelBuilder builder;
+
+    // Level storage, owned by the worker while Working and by take() otherwise
+    Maze maze;
+    EntityStore entities;
+    OccupancyGrid occupancy;
+
+    std::thread worker;                 // Started on the first request
+    std::mutex mutex;                   // Guards everything below
+    std::condition_variable wakeWorker; // Signalled on a new request or on shutdown
+    std::condition_variable jobDone;    // Signalled when the worker finishes a level
+    State state;
+    bool requestPending;                // A request is waiting for the worker
+    bool discardCurrent;                // The level being built is no longer wanted
+    bool stopping;
+    LevelSpec requestSpec;              // Pending request
+    LevelSpec workSpec;                 // Level being built or ready
+
+    void workerLoop();
+
+public:
+    // Constructor
+    explicit LevelPregenerator(LevelBuilder levelBuilder);
+
+    // Destructor (waits for the worker to finish its current level)
+    ~LevelPregenerator();
+
+    // Not copyable: owns a thread
+    LevelPregenerator(const LevelPregenerator&) = delete;
+    LevelPregenerator& operator=(const LevelPregenerator&) = delete;
+
+    // Pregeneration
+    void request(const LevelSpec& spec);
+    void cancel();
+    bool take(const LevelSpec& spec, Maze& targetMaze, EntityStore& targetEntities, OccupancyGrid& targetOccupancy);
+};
+
+#endif // LEVELPREGENERATOR_H
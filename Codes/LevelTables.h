@@ -0,0 +1,182 @@
+#ifndef LEVELTABLES_H
+#define LEVELTABLES_H
+
+/**
+ * Hand-authored levels, built and checked at compile time
+ *
+ * A layout is written as rows of characters ('#' wall, ' ' floor, 'E'
+ * exit) and turned into a LevelTable by makeLevelTable during compilation.
+ * The table holds the cells exactly as Maze stores them, so loading one
+ * is a single copy. Every layout is checked with static_assert below: it
+ * must use only known characters, be enclosed by walls, have exactly one
+ * exit and an open start at (1,1), and the exit must be reachable from the
+ * start (a breadth-first search run by the compiler). A broken layout
+ * stops the build.
+ */
+
+/**
+ * Level layout as Maze stores it: width * height cells, row by row
+ */
+template <int W, int H>
+struct LevelTable {
+    static_assert(W >= 4 && H >= 4, "Levels need room for a border, a start and an exit");
+
+    static const int width = W;
+    static const int height = H;
+    char cells[W * H];
+    int exitX, exitY;                 // Position of the 'E' cell (-1 if there is none)
+};
+
+/**
+ * Build a level table from rows of characters
+ * @param rows Layout, one string per row
+ * @return Table with the rows joined and the exit located
+ */
+template <int W, int H>
+constexpr LevelTable<W, H> makeLevelTable(const char (&rows)[H][W + 1]) {
+    LevelTable<W, H> table{};
+    table.exitX = -1;
+    table.exitY = -1;
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            table.cells[y * W + x] = rows[y][x];
+            if (rows[y][x] == 'E') {
+                table.exitX = x;
+                table.exitY = y;
+            }
+        }
+    }
+    return table;
+}
+
+/**
+ * Check that every row of a layout is exactly the table width
+ * @param rows Layout, one string per row
+ * @return true if no row is short (a long row does not compile)
+ */
+template <int W, int H>
+constexpr bool hasFullRows(const char (&rows)[H][W + 1]) {
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x++) {
+            if (rows[y][x] == '\0') {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Check that a level only uses walls, floor and the exit
+ * @param table Level to check
+ * @return true if every cell is '#', ' ' or 'E'
+ */
+template <int W, int H>
+constexpr bool hasOnlyKnownCells(const LevelTable<W, H>& table) {
+    for (int i = 0; i < W * H; i++) {
+        const char cell = table.cells[i];
+        if (cell != '#' && cell != ' ' && cell != 'E') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Check that a level is enclosed by walls
+ * @param table Level to check
+ * @return true if the outermost rows and columns are all walls
+ */
+template <int W, int H>
+constexpr bool hasBorderWalls(const LevelTable<W, H>& table) {
+    for (int x = 0; x < W; x++) {
+        if (table.cells[x] != '#' || table.cells[(H - 1) * W + x] != '#') {
+            return false;
+        }
+    }
+    for (int y = 0; y < H; y++) {
+        if (table.cells[y * W] != '#' || table.cells[y * W + W - 1] != '#') {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Count the exits of a level
+ * @param table Level to check
+ * @return Number of 'E' cells
+ */
+template <int W, int H>
+constexpr int countExits(const LevelTable<W, H>& table) {
+    int exits = 0;
+    for (int i = 0; i < W * H; i++) {
+        exits += table.cells[i] == 'E' ? 1 : 0;
+    }
+    return exits;
+}
+
+/**
+ * Check that the exit can be reached from the start (1,1)
+ * Breadth-first search over the open cells, evaluated by the compiler
+ * @param table Level to check
+ * @return true if the start is open and a path leads to the exit
+ */
+template <int W, int H>
+constexpr bool isExitReachable(const LevelTable<W, H>& table) {
+    if (table.exitX < 0 || table.cells[W + 1] == '#') {
+        return false;
+    }
+
+    bool seen[W * H] = {};
+    int queue[W * H] = {};
+    const int directionX[4] = {0, 1, 0, -1};
+    const int directionY[4] = {-1, 0, 1, 0};
+    const int goal = table.exitY * W + table.exitX;
+
+    int head = 0, tail = 0;
+    queue[tail++] = W + 1;
+    seen[W + 1] = true;
+    while (head < tail) {
+        const int cell = queue[head++];
+        if (cell == goal) {
+            return true;
+        }
+        for (int d = 0; d < 4; d++) {
+            const int x = cell % W + directionX[d];
+            const int y = cell / W + directionY[d];
+            if (x < 0 || y < 0 || x >= W || y >= H) {
+                continue;
+            }
+            const int next = y * W + x;
+            if (!seen[next] && table.cells[next] != '#') {
+                seen[next] = true;
+                queue[tail++] = next;
+            }
+        }
+    }
+    return false;
+}
+
+// Level 1 at the default size
+constexpr char DEFAULT_LEVEL_ROWS[10][11] = {
+    "##########",
+    "#   #    #",
+    "# # # ## #",
+    "# #    # #",
+    "# #### # #",
+    "#      # #",
+    "### # ## #",
+    "#   #    #",
+    "# ######E#",
+    "##########"
+};
+constexpr LevelTable<10, 10> DEFAULT_LEVEL = makeLevelTable<10, 10>(DEFAULT_LEVEL_ROWS);
+
+static_assert(hasFullRows<10, 10>(DEFAULT_LEVEL_ROWS), "Default level has a short row");
+static_assert(hasOnlyKnownCells(DEFAULT_LEVEL), "Default level uses a cell other than '#', ' ' or 'E'");
+static_assert(hasBorderWalls(DEFAULT_LEVEL), "Default level must be enclosed by walls");
+static_assert(countExits(DEFAULT_LEVEL) == 1, "Default level must have exactly one exit");
+static_assert(isExitReachable(DEFAULT_LEVEL), "Default level exit cannot be reached from the start");
+
+#endif // LEVELTABLES_H
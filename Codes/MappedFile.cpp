@@ -0,0 +1,164 @@
+#include "MappedFile.h"
+#include <fstream>
+#include <algorithm>
+
+#ifndef _WIN32
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+/**
+ * Constructor for MappedFile class
+ */
+MappedFile::MappedFile() : bytes(nullptr), length(0), mapped(false) {
+}
+
+/**
+ * Destructor for MappedFile class
+ */
+MappedFile::~MappedFile() {
+    close();
+}
+
+/**
+ * Make the contents of a file available through data()
+ * Any previously opened file is closed first
+ * @param filename Path of the file
+ * @param readAhead Fault the whole mapping in up front (for files read in full)
+ * @return true if the file could be opened (an empty file counts)
+ */
+bool MappedFile::open(const std::string& filename, bool readAhead) {
+    close();
+
+#ifndef _WIN32
+    int descriptor = ::open(filename.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0) {
+        ::close(descriptor);
+        return false;
+    }
+
+    if (status.st_size > 0) {
+        int flags = MAP_PRIVATE;
+#ifdef MAP_POPULATE
+        if (readAhead) {
+            flags |= MAP_POPULATE; // The whole file is read straight away; fault it in up front
+        }
+#else
+        (void)readAhead;
+#endif
+        void* region = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, flags, descriptor, 0);
+        if (region != MAP_FAILED) {
+            ::close(descriptor); // The mapping stays valid without the descriptor
+            bytes = static_cast<const char*>(region);
+            length = static_cast<size_t>(status.st_size);
+            mapped = true;
+            return true;
+        }
+    }
+    ::close(descriptor);
+    // Empty files cannot be mapped; other failures fall through to a plain read
+#endif
+
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+    std::streamoff fileSize = file.tellg();
+    if (fileSize < 0) {
+        return false;
+    }
+    buffer.resize(static_cast<size_t>(fileSize) + 1); // Never empty, so data() is never null
+    file.seekg(0);
+    if (fileSize > 0 && !file.read(buffer.data(), fileSize)) {
+        buffer.clear();
+        return false;
+    }
+    bytes = buffer.data();
+    length = static_cast<size_t>(fileSize);
+    return true;
+}
+
+/**
+ * Release the mapping or buffer
+ */
+void MappedFile::close() {
+#ifndef _WIN32
+    if (mapped) {
+        munmap(const_cast<char*>(bytes), length);
+    }
+#endif
+    std::vector<char>().swap(buffer);
+    bytes = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+#ifndef _WIN32
+/**
+ * Widen a byte range of the mapping to whole pages, as madvise requires
+ * @param base Start of the mapping (page aligned)
+ * @param length Size of the mapping
+ * @param offset First byte of the range
+ * @param count Bytes in the range
+ * @param start Receives the first page of the range
+ * @param size Receives the length of the widened range
+ * @return false if the range is empty or outside the mapping
+ */
+static bool pageRange(const char* base, size_t length, size_t offset, size_t count,
+                      char*& start, size_t& size) {
+    if (offset >= length || count == 0) {
+        return false;
+    }
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t end = std::min(length, offset + count);
+    const size_t first = offset / pageSize * pageSize;
+    start = const_cast<char*>(base) + first;
+    size = end - first;
+    return true;
+}
+#endif
+
+/**
+ * Ask for part of the file to be read in the background
+ * Returns at once; later reads of the range then find it in memory
+ * @param offset First byte wanted
+ * @param count Bytes wanted
+ */
+void MappedFile::prefetch(size_t offset, size_t count) const {
+#ifndef _WIN32
+    char* start;
+    size_t size;
+    if (mapped && pageRange(bytes, length, offset, count, start, size)) {
+        madvise(start, size, MADV_WILLNEED);
+    }
+#else
+    (void)offset;
+    (void)count;
+#endif
+}
+
+/**
+ * Let the system drop part of the file from memory
+ * The range stays readable and is simply read again if touched
+ * @param offset First byte no longer needed
+ * @param count Bytes no longer needed
+ */
+void MappedFile::release(size_t offset, size_t count) const {
+#ifndef _WIN32
+    char* start;
+    size_t size;
+    if (mapped && pageRange(bytes, length, offset, count, start, size)) {
+        madvise(start, size, MADV_DONTNEED);
+    }
+#else
+    (void)offset;
+    (void)count;
+#endif
+}
@@ -0,0 +1,47 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+/**
+ * MappedFile class giving read-only access to a whole file in memory
+ * Maps the file with mmap so loading costs no copies or parsing, and
+ * falls back to reading it into a buffer where mmap is not available.
+ * Files too big to read whole can be opened without read-ahead and paged
+ * in and out piece by piece with prefetch and release.
+ */
+class MappedFile {
+private:
+    const char* bytes;        // First byte of the file contents
+    size_t length;            // File size in bytes
+    bool mapped;              // bytes points at an mmap region (else at buffer)
+    std::vector<char> buffer; // File contents when not mapped
+
+public:
+    // Constructor
+    MappedFile();
+
+    // Destructor (unmaps the file)
+    ~MappedFile();
+
+    // Not copyable: owns the mapping
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // File access
+    bool open(const std::string& filename, bool readAhead = true);
+    void close();
+
+    // Paging hints (no effect unless the file is mapped)
+    void prefetch(size_t offset, size_t count) const;
+    void release(size_t offset, size_t count) const;
+
+    // Getters
+    bool isOpen() const { return bytes != nullptr; }
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+#endif // MAPPEDFILE_H
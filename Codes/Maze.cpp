@@ -1,8 +1,14 @@
 #include "Maze.h"
+#include "LevelTables.h"
 #include <iostream>
 #include <fstream>
+#include <algorithm>
 #include <cstdlib>
-#include <ctime>
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
 
 #ifdef _WIN32
     #include <windows.h>
@@ -13,50 +19,102 @@
 
 /**
  * Constructor for Maze class
- * Initializes the maze with default layout
+ * Initializes the maze with default layout when using the default size,
+ * otherwise generates a level 1 layout of the requested size
+ * @param mazeWidth Width of the maze in cells
+ * @param mazeHeight Height of the maze in cells
  */
-Maze::Maze() : exitX(8), exitY(8) {
-    initializeDefaultMaze();
+Maze::Maze(int mazeWidth, int mazeHeight) : width(0), height(0), exitX(0), exitY(0), wordsPerRow(0), repairedWalls(0) {
+    resize(mazeWidth, mazeHeight);
+    initializeMaze(1);
 }
 
 /**
- * Initialize the maze with a default layout
+ * Change the maze dimensions
+ * Dimensions are clamped to the supported range and all cells become walls
+ * @param newWidth New width in cells
+ * @param newHeight New height in cells
  */
-void Maze::initializeDefaultMaze() {
-    // Create a simple default maze layout
-    char defaultMaze[MAZE_SIZE][MAZE_SIZE] = {
-        {'#', '#', '#', '#', '#', '#', '#', '#', '#', '#'},
-        {'#', ' ', ' ', ' ', '#', ' ', ' ', ' ', ' ', '#'},
-        {'#', ' ', '#', ' ', '#', ' ', '#', '#', ' ', '#'},
-        {'#', ' ', '#', ' ', ' ', ' ', ' ', '#', ' ', '#'},
-        {'#', ' ', '#', '#', '#', '#', ' ', '#', ' ', '#'},
-        {'#', ' ', ' ', ' ', ' ', ' ', ' ', '#', ' ', '#'},
-        {'#', '#', '#', ' ', '#', ' ', '#', '#', ' ', '#'},
-        {'#', ' ', ' ', ' ', '#', ' ', ' ', ' ', ' ', '#'},
-        {'#', ' ', '#', '#', '#', '#', '#', '#', 'E', '#'},
-        {'#', '#', '#', '#', '#', '#', '#', '#', '#', '#'}
-    };
-
-    // Copy default maze to grid
-    for (int i = 0; i < MAZE_SIZE; i++) {
-        for (int j = 0; j < MAZE_SIZE; j++) {
-            grid[i][j] = defaultMaze[i][j];
-        }
+void Maze::resize(int newWidth, int newHeight) {
+    const int maxSize = MAX_SIZE;  // std::min takes references; keep it from needing a definition
+    width = std::max(4, std::min(newWidth, maxSize));
+    height = std::max(4, std::min(newHeight, maxSize));
+    grid.assign(static_cast<size_t>(width) * height, '#');
+    wordsPerRow = (width + 63) / 64;
+    openMask.assign(static_cast<size_t>(wordsPerRow) * height, 0);
+    exitX = width - 2;
+    exitY = height - 2;
+    repairedWalls = 0;
+}
+
+/**
+ * Exchange contents with another maze
+ * Only buffer pointers change hands, so this is constant time.
+ * Pathfinding scratch state stays with each object.
+ * @param other Maze to swap with
+ */
+void Maze::swap(Maze& other) {
+    std::swap(width, other.width);
+    std::swap(height, other.height);
+    grid.swap(other.grid);
+    std::swap(exitX, other.exitX);
+    std::swap(exitY, other.exitY);
+    std::swap(wordsPerRow, other.wordsPerRow);
+    openMask.swap(other.openMask);
+    reachMask.swap(other.reachMask);
+    reachQueue.swap(other.reachQueue);
+    std::swap(repairedWalls, other.repairedWalls);
+    std::swap(random, other.random);
+}
+
+/**
+ * Replace the whole grid with a block of row-major cells
+ * The exit position is reset as by resize; callers restore it afterwards
+ * @param cells newWidth * newHeight cell characters, row by row
+ * @param newWidth Width of the block in cells
+ * @param newHeight Height of the block in cells
+ * @return false (maze unchanged) if the size is outside the supported range
+ */
+bool Maze::assignCells(const char* cells, int newWidth, int newHeight) {
+    if (newWidth < 4 || newHeight < 4 || newWidth > MAX_SIZE || newHeight > MAX_SIZE) {
+        return false;
     }
+    // Same effect as resize followed by a copy, without filling the grid first
+    width = newWidth;
+    height = newHeight;
+    grid.assign(cells, cells + static_cast<size_t>(width) * height);
+    wordsPerRow = (width + 63) / 64;
+    openMask.resize(static_cast<size_t>(wordsPerRow) * height);  // Every word is rewritten below
+    exitX = width - 2;
+    exitY = height - 2;
+    rebuildOpenMask();
+    return true;
+}
 
-    exitX = 8;
-    exitY = 8;
+/**
+ * Initialize the maze with a default layout
+ * The hand-made layout is 10x10, so the maze is resized to match
+ */
+void Maze::initializeDefaultMaze() {
+    // The layout is built and validated at compile time, so loading it is one copy
+    static_assert(DEFAULT_LEVEL.width == DEFAULT_SIZE && DEFAULT_LEVEL.height == DEFAULT_SIZE,
+                  "The level 1 layout must have the default maze size");
+    assignCells(DEFAULT_LEVEL.cells, DEFAULT_LEVEL.width, DEFAULT_LEVEL.height);
+    exitX = DEFAULT_LEVEL.exitX;
+    exitY = DEFAULT_LEVEL.exitY;
 }
 
 /**
  * Initialize maze for a specific level
  * @param level Level number to generate
  */
-void Maze::initializeMaze(int level) {
-    if (level == 1) {
+void Maze::initializeMaze(int level, MazeAlgorithm algorithm) {
+    // The hand-made layout only fits the default size
+    if (level == 1 && width == DEFAULT_SIZE && height == DEFAULT_SIZE &&
+        algorithm == MazeAlgorithm::ScatteredWalls) {
         initializeDefaultMaze();
     } else {
-        generateLevel(level);
+        generateLevel(level, algorithm);
     }
 }
 
@@ -64,9 +122,9 @@ void Maze::initializeMaze(int level) {
  * Display the complete maze to console
  */
 void Maze::display() const {
-    for (int i = 0; i < MAZE_SIZE; i++) {
-        for (int j = 0; j < MAZE_SIZE; j++) {
-            std::cout << grid[i][j] << " ";
+    for (int i = 0; i < height; i++) {
+        for (int j = 0; j < width; j++) {
+            std::cout << grid[i * width + j] << " ";
         }
         std::cout << std::endl;
     }
@@ -74,12 +132,13 @@ void Maze::display() const {
 
 /**
  * Clear the console screen
+ * Uses ANSI escape sequences rather than spawning a shell
  */
 void Maze::clearScreen() const {
 #ifdef _WIN32
     system("cls");
 #else
-    system("clear");
+    std::cout << "\x1b[H\x1b[2J" << std::flush;
 #endif
 }
 
@@ -95,16 +154,14 @@ bool Maze::saveToFile(const std::string& filename) const {
     }
 
     // Save maze dimensions
-    file << MAZE_SIZE << " " << MAZE_SIZE << std::endl;
+    file << width << " " << height << std::endl;
 
     // Save exit position
     file << exitX << " " << exitY << std::endl;
 
     // Save maze grid
-    for (int i = 0; i < MAZE_SIZE; i++) {
-        for (int j = 0; j < MAZE_SIZE; j++) {
-            file << grid[i][j];
-        }
+    for (int i = 0; i < height; i++) {
+        file.write(&grid[i * width], width);
         file << std::endl;
     }
 
@@ -123,30 +180,34 @@ bool Maze::loadFromFile(const std::string& filename) {
         return false;
     }
 
-    int width, height;
-    file >> width >> height;
+    int fileWidth, fileHeight;
+    file >> fileWidth >> fileHeight;
 
-    // Check if dimensions match
-    if (width != MAZE_SIZE || height != MAZE_SIZE) {
+    // Check if dimensions are supported
+    if (!file || fileWidth < 4 || fileHeight < 4 ||
+        fileWidth > MAX_SIZE || fileHeight > MAX_SIZE) {
         file.close();
         return false;
     }
 
     // Load exit position
-    file >> exitX >> exitY;
+    int fileExitX, fileExitY;
+    file >> fileExitX >> fileExitY;
+
+    resize(fileWidth, fileHeight);
+    setExitPosition(fileExitX, fileExitY);
 
     // Load maze grid
     std::string line;
     std::getline(file, line); // consume newline
 
-    for (int i = 0; i < MAZE_SIZE; i++) {
+    for (int i = 0; i < height; i++) {
         std::getline(file, line);
-        if (line.length() >= MAZE_SIZE) {
-            for (int j = 0; j < MAZE_SIZE; j++) {
-                grid[i][j] = line[j];
-            }
+        if (line.length() >= static_cast<size_t>(width)) {
+            std::copy(line.begin(), line.begin() + width, grid.begin() + i * width);
         }
     }
+    rebuildOpenMask();
 
     file.close();
     return true;
@@ -160,7 +221,7 @@ bool Maze::loadFromFile(const std::string& filename) {
  */
 char Maze::getCell(int x, int y) const {
     if (isValidPosition(x, y)) {
-        return grid[y][x];
+        return grid[y * width + x];
     }
     return '#'; // Return wall for invalid positions
 }
@@ -173,7 +234,15 @@ char Maze::getCell(int x, int y) const {
  */
 void Maze::setCell(int x, int y, char value) {
     if (isValidPosition(x, y)) {
-        grid[y][x] = value;
+        grid[y * width + x] = value;
+
+        uint64_t& word = openMask[y * wordsPerRow + (x >> 6)];
+        const uint64_t bit = uint64_t(1) << (x & 63);
+        if (value == '#') {
+            word &= ~bit;
+        } else {
+            word |= bit;
+        }
     }
 }
 
@@ -184,7 +253,7 @@ void Maze::setCell(int x, int y, char value) {
  * @return true if valid, false otherwise
  */
 bool Maze::isValidPosition(int x, int y) const {
-    return x >= 0 && x < MAZE_SIZE && y >= 0 && y < MAZE_SIZE;
+    return x >= 0 && x < width && y >= 0 && y < height;
 }
 
 /**
@@ -194,7 +263,30 @@ bool Maze::isValidPosition(int x, int y) const {
  * @return true if wall, false otherwise
  */
 bool Maze::isWall(int x, int y) const {
-    return getCell(x, y) == '#';
+    return !isOpen(x, y);
+}
+
+/**
+ * Get a read-only view of the maze storage
+ * The view is invalidated by resize (and by loading a maze of another size)
+ * @return Non-owning view of the grid and open mask
+ */
+MazeView Maze::view() const {
+    return MazeView(grid.data(), openMask.data(), width, height, wordsPerRow);
+}
+
+/**
+ * Check if position is inside the maze and not a wall
+ * Reads the bit-packed open mask instead of the character grid
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @return true if open, false for walls and out-of-bounds positions
+ */
+bool Maze::isOpen(int x, int y) const {
+    if (!isValidPosition(x, y)) {
+        return false;
+    }
+    return (openMask[y * wordsPerRow + (x >> 6)] >> (x & 63)) & 1;
 }
 
 /**
@@ -217,30 +309,59 @@ void Maze::getExitPosition(int& x, int& y) const {
     y = exitY;
 }
 
+/**
+ * Set exit position
+ * @param x Exit X coordinate
+ * @param y Exit Y coordinate
+ */
+void Maze::setExitPosition(int x, int y) {
+    if (isValidPosition(x, y)) {
+        exitX = x;
+        exitY = y;
+    }
+}
+
 /**
  * Generate a level with increasing difficulty
+ * Perfect-maze algorithms ignore the level number: their difficulty comes
+ * from the maze size
  * @param levelNumber Level to generate (higher = more difficult)
+ * @param algorithm Layout algorithm
  */
-void Maze::generateLevel(int levelNumber) {
+void Maze::generateLevel(int levelNumber, MazeAlgorithm algorithm) {
+    if (algorithm != MazeAlgorithm::ScatteredWalls) {
+        exitX = width - 2;
+        exitY = height - 2;
+        generator.generate(grid.data(), width, height, algorithm, exitX, exitY, random);
+        grid[exitY * width + exitX] = 'E';
+        rebuildOpenMask();
+        repairedWalls = 0;  // A perfect maze connects every open cell by construction
+        return;
+    }
+
     // Start with empty maze
-    for (int i = 0; i < MAZE_SIZE; i++) {
-        for (int j = 0; j < MAZE_SIZE; j++) {
-            if (i == 0 || i == MAZE_SIZE-1 || j == 0 || j == MAZE_SIZE-1) {
-                grid[i][j] = '#'; // Border walls
-            } else {
-                grid[i][j] = ' '; // Empty space
-            }
+    for (int i = 0; i < height; i++) {
+        char* row = &grid[i * width];
+        if (i == 0 || i == height - 1) {
+            std::fill(row, row + width, '#'); // Border walls
+        } else {
+            std::fill(row + 1, row + width - 1, ' '); // Empty space
+            row[0] = '#';
+            row[width - 1] = '#';
         }
     }
 
-    // Add walls based on level difficulty
-    int wallDensity = 10 + (levelNumber * 5); // Increase wall density per level
-    addWalls(wallDensity);
-
     // Set exit position
-    exitX = MAZE_SIZE - 2;
-    exitY = MAZE_SIZE - 2;
-    grid[exitY][exitX] = 'E';
+    exitX = width - 2;
+    exitY = height - 2;
+
+    // Add walls based on level difficulty, scaled from the 10x10 baseline
+    long long wallDensity = 10 + (levelNumber * 5); // Increase wall density per level
+    wallDensity = wallDensity * width * height / (DEFAULT_SIZE * DEFAULT_SIZE);
+    addWalls(static_cast<int>(wallDensity));
+
+    grid[exitY * width + exitX] = 'E';
+    rebuildOpenMask();
 
     // Ensure there's always a path from start to exit
     ensurePathExists();
@@ -251,42 +372,310 @@ void Maze::generateLevel(int levelNumber) {
  * @param density Number of walls to add
  */
 void Maze::addWalls(int density) {
-    static bool seeded = false;
-    if (!seeded) {
-        srand(static_cast<unsigned int>(time(nullptr)));
-        seeded = true;
-    }
-
     for (int i = 0; i < density; i++) {
-        int x = rand() % (MAZE_SIZE - 2) + 1; // Avoid borders
-        int y = rand() % (MAZE_SIZE - 2) + 1;
+        int x = random.below(width - 2) + 1; // Avoid borders
+        int y = random.below(height - 2) + 1;
 
         // Don't place walls on start or exit positions
         if ((x == 1 && y == 1) || (x == exitX && y == exitY)) {
             continue;
         }
 
-        grid[y][x] = '#';
+        setCell(x, y, '#');
     }
 }
 
 /**
- * Ensure there's always a basic path from start to exit
- * Creates a simple L-shaped path as fallback
+ * Ensure there's always a path from start to exit
+ * When the exit is unreachable, opens the fewest interior walls that
+ * connect (1,1) to it, so the rest of the generated layout is kept
  */
 void Maze::ensurePathExists() {
-    // Create a simple path from (1,1) to exit
-    // Horizontal path first
-    for (int x = 1; x <= exitX; x++) {
-        if (grid[1][x] == '#' && !(x == exitX && 1 == exitY)) {
-            grid[1][x] = ' ';
+    repairedWalls = 0;
+    if (isExitReachable()) {
+        return;
+    }
+
+    if (pathfinder.findMinimalRepair(view(), 1, 1, exitX, exitY) == Pathfinder::NO_PATH) {
+        return;
+    }
+    const std::vector<int32_t>& walls = pathfinder.getRepairCells();
+    for (size_t i = 0; i < walls.size(); i++) {
+        setCell(walls[i] % width, walls[i] / width, ' ');
+    }
+    repairedWalls = static_cast<int>(walls.size());
+}
+
+/**
+ * Length of the shortest path from the start position (1,1) to the exit
+ * @return Number of steps, or Pathfinder::NO_PATH if the exit is unreachable
+ */
+int Maze::getExitPathLength() const {
+    return pathfinder.findPath(view(), 1, 1, exitX, exitY);
+}
+
+/**
+ * Open bits of eight consecutive cells, eight cells per load (SWAR)
+ * Assumes a little-endian machine, like the bit layout of the mask itself
+ * @param cells First of the eight cells
+ * @return Bit i set when cells[i] is not a wall
+ */
+static inline uint64_t openBitsOfEight(const char* cells) {
+    const uint64_t low7 = 0x7F7F7F7F7F7F7F7FULL;
+    uint64_t bytes;
+    std::memcpy(&bytes, cells, 8);
+    bytes ^= 0x2323232323232323ULL;                             // Walls ('#') become zero bytes
+    uint64_t nonZero = (((bytes & low7) + low7) | bytes) >> 7;  // Bit 0 of each byte: byte != 0
+    nonZero &= 0x0101010101010101ULL;
+    return (nonZero * 0x0102040810204080ULL) >> 56;             // Gather byte i's bit into bit i
+}
+
+/**
+ * Rebuild the bit-packed open mask from the character grid
+ * Called after bulk grid writes that bypass setCell
+ */
+void Maze::rebuildOpenMask() {
+    for (int y = 0; y < height; y++) {
+        const char* row = &grid[y * width];
+        uint64_t* maskRow = &openMask[y * wordsPerRow];
+        for (int word = 0; word < wordsPerRow; word++) {
+            const int first = word * 64;
+            const int last = std::min(first + 64, width);
+            uint64_t bits = 0;
+            int x = first;
+            for (; x + 8 <= last; x += 8) {
+                bits |= openBitsOfEight(row + x) << (x - first);
+            }
+            for (; x < last; x++) {
+                bits |= static_cast<uint64_t>(row[x] != '#') << (x - first);
+            }
+            maskRow[word] = bits;
+        }
+    }
+}
+
+/**
+ * Spread reach bits towards higher bit positions (+x) through open bits
+ * Kogge-Stone occluded fill, log2(64) shift-and-mask steps
+ * @param reach Seed bits
+ * @param open Open cells of the same word
+ * @return Seeds extended along their open runs
+ */
+static inline uint64_t fillTowardsHigh(uint64_t reach, uint64_t open) {
+    reach &= open;
+    reach |= open & (reach << 1);  open &= open << 1;
+    reach |= open & (reach << 2);  open &= open << 2;
+    reach |= open & (reach << 4);  open &= open << 4;
+    reach |= open & (reach << 8);  open &= open << 8;
+    reach |= open & (reach << 16); open &= open << 16;
+    reach |= open & (reach << 32);
+    return reach;
+}
+
+/**
+ * Spread reach bits towards lower bit positions (-x) through open bits
+ * @param reach Seed bits
+ * @param open Open cells of the same word
+ * @return Seeds extended along their open runs
+ */
+static inline uint64_t fillTowardsLow(uint64_t reach, uint64_t open) {
+    reach &= open;
+    reach |= open & (reach >> 1);  open &= open >> 1;
+    reach |= open & (reach >> 2);  open &= open >> 2;
+    reach |= open & (reach >> 4);  open &= open >> 4;
+    reach |= open & (reach >> 8);  open &= open >> 8;
+    reach |= open & (reach >> 16); open &= open >> 16;
+    reach |= open & (reach >> 32);
+    return reach;
+}
+
+/**
+ * Seed one row from its neighbour row and fill it horizontally
+ * Every open run that touches a reached cell becomes fully reached
+ * @param reach Reach bits of the row being filled
+ * @param from Reach bits of the neighbouring row (already filled)
+ * @param open Open mask of the row being filled
+ * @param words Number of 64-bit words per row
+ * @return true if any new cell was reached
+ */
+static bool fillRow(uint64_t* reach, const uint64_t* from, const uint64_t* open, int words) {
+    bool changed = false;
+    int i = 0;
+
+#if defined(__AVX2__)
+    // Vertical step and in-word fill on four words at a time
+    for (; i + 4 <= words; i += 4) {
+        __m256i r = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(reach + i));
+        const __m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + i));
+        const __m256i o = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(open + i));
+        const __m256i before = r;
+        r = _mm256_and_si256(_mm256_or_si256(r, f), o);
+
+        __m256i up = r, upOpen = o, down = r, downOpen = o;
+        for (int shift = 1; shift < 64; shift <<= 1) {
+            const __m128i count = _mm_cvtsi32_si128(shift);
+            up = _mm256_or_si256(up, _mm256_and_si256(upOpen, _mm256_sll_epi64(up, count)));
+            upOpen = _mm256_and_si256(upOpen, _mm256_sll_epi64(upOpen, count));
+            down = _mm256_or_si256(down, _mm256_and_si256(downOpen, _mm256_srl_epi64(down, count)));
+            downOpen = _mm256_and_si256(downOpen, _mm256_srl_epi64(downOpen, count));
         }
+        r = _mm256_or_si256(up, down);
+
+        const __m256i diff = _mm256_xor_si256(r, before);
+        changed |= !_mm256_testz_si256(diff, diff);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(reach + i), r);
+    }
+#endif
+
+    for (; i < words; i++) {
+        const uint64_t seed = (reach[i] | from[i]) & open[i];
+        const uint64_t filled = fillTowardsHigh(seed, open[i]) | fillTowardsLow(seed, open[i]);
+        changed |= filled != reach[i];
+        reach[i] = filled;
     }
 
-    // Vertical path
-    for (int y = 1; y <= exitY; y++) {
-        if (grid[y][exitX] == '#' && y != exitY) {
-            grid[y][exitX] = ' ';
+    // Carry runs across word boundaries, upwards then downwards
+    for (i = 0; i + 1 < words; i++) {
+        if ((reach[i] >> 63) && (open[i + 1] & 1) && !(reach[i + 1] & 1)) {
+            reach[i + 1] |= fillTowardsHigh(1, open[i + 1]);
+            changed = true;
+        }
+    }
+    for (i = words - 1; i > 0; i--) {
+        if ((reach[i] & 1) && (open[i - 1] >> 63) && !(reach[i - 1] >> 63)) {
+            reach[i - 1] |= fillTowardsLow(uint64_t(1) << 63, open[i - 1]);
+            changed = true;
         }
     }
+
+    return changed;
+}
+
+/**
+ * Flood fill the reach mask from an open cell
+ * Runs a word-parallel flood fill: rows are filled with shift-and-mask
+ * operations and alternately swept downwards and upwards until stable.
+ * Falls back to a queue-based fill if that takes too many passes.
+ * @param fromX Start X coordinate (must be open)
+ * @param fromY Start Y coordinate (must be open)
+ * @param stopX X coordinate of a cell that ends the fill once reached, or -1 to fill everything
+ * @param stopY Y coordinate of that cell
+ */
+void Maze::floodFrom(int fromX, int fromY, int stopX, int stopY) const {
+    reachMask.assign(openMask.size(), 0);
+    reachMask[fromY * wordsPerRow + (fromX >> 6)] = uint64_t(1) << (fromX & 63);
+
+    const uint64_t* open = openMask.data();
+    uint64_t* reach = reachMask.data();
+    const uint64_t neverSet = 0;
+    const uint64_t* target = stopX < 0 ? &neverSet : &reach[stopY * wordsPerRow + (stopX >> 6)];
+    const uint64_t targetBit = stopX < 0 ? 1 : uint64_t(1) << (stopX & 63);
+
+    // The start row has no filled neighbour yet, so seed it from itself
+    uint64_t* startRow = reach + fromY * wordsPerRow;
+    fillRow(startRow, startRow, open + fromY * wordsPerRow, wordsPerRow);
+
+    // Each pass only gets round one bend that doubles back vertically, so
+    // winding corridors (perfect mazes) would need thousands of passes
+    bool changed = true;
+    for (int pass = 0; changed && !(*target & targetBit); pass++) {
+        if (pass == MAX_SWEEP_PASSES) {
+            floodByQueue(fromX, fromY);
+            return;
+        }
+        changed = false;
+        for (int y = 1; y < height; y++) {
+            changed |= fillRow(reach + y * wordsPerRow, reach + (y - 1) * wordsPerRow,
+                               open + y * wordsPerRow, wordsPerRow);
+        }
+        for (int y = height - 2; y >= 0; y--) {
+            changed |= fillRow(reach + y * wordsPerRow, reach + (y + 1) * wordsPerRow,
+                               open + y * wordsPerRow, wordsPerRow);
+        }
+    }
+}
+
+/**
+ * Flood fill the reach mask one cell at a time with a breadth-first queue
+ * Linear in the number of reachable cells however the corridors wind
+ * @param fromX Start X coordinate (must be open)
+ * @param fromY Start Y coordinate (must be open)
+ */
+void Maze::floodByQueue(int fromX, int fromY) const {
+    reachMask.assign(openMask.size(), 0);
+    reachQueue.clear();
+    reachQueue.reserve(grid.size());
+
+    uint64_t* reach = reachMask.data();
+    reach[fromY * wordsPerRow + (fromX >> 6)] |= uint64_t(1) << (fromX & 63);
+    reachQueue.push_back(fromY * width + fromX);
+
+    static const int directionX[4] = {0, 1, 0, -1};
+    static const int directionY[4] = {-1, 0, 1, 0};
+    for (size_t head = 0; head < reachQueue.size(); head++) {
+        const int x = reachQueue[head] % width;
+        const int y = reachQueue[head] / width;
+        for (int d = 0; d < 4; d++) {
+            const int nx = x + directionX[d];
+            const int ny = y + directionY[d];
+            if (!isOpen(nx, ny)) {
+                continue;
+            }
+            uint64_t& word = reach[ny * wordsPerRow + (nx >> 6)];
+            const uint64_t bit = uint64_t(1) << (nx & 63);
+            if (!(word & bit)) {
+                word |= bit;
+                reachQueue.push_back(ny * width + nx);
+            }
+        }
+    }
+}
+
+/**
+ * Check whether one cell can be reached from another through open cells
+ * @param fromX Start X coordinate
+ * @param fromY Start Y coordinate
+ * @param toX Target X coordinate
+ * @param toY Target Y coordinate
+ * @return true if a 4-connected path of open cells exists
+ */
+bool Maze::isReachable(int fromX, int fromY, int toX, int toY) const {
+    if (!isOpen(fromX, fromY) || !isOpen(toX, toY)) {
+        return false;
+    }
+    floodFrom(fromX, fromY, toX, toY);
+    return wasReached(toX, toY);
+}
+
+/**
+ * Mark every cell reachable from a start cell, for later wasReached queries
+ * Stays valid until the next reachability check or grid change
+ * @param x Start X coordinate
+ * @param y Start Y coordinate
+ */
+void Maze::markReachableFrom(int x, int y) const {
+    if (!isOpen(x, y)) {
+        reachMask.assign(openMask.size(), 0);
+        return;
+    }
+    floodFrom(x, y, -1, -1);
+}
+
+/**
+ * Check a cell against the last markReachableFrom (or isReachable) fill
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @return true if the cell was reached
+ */
+bool Maze::wasReached(int x, int y) const {
+    return isValidPosition(x, y) && reachMask.size() == openMask.size() &&
+           ((reachMask[y * wordsPerRow + (x >> 6)] >> (x & 63)) & 1);
+}
+
+/**
+ * Check whether the exit can be reached from the start position (1,1)
+ * @return true if a path exists
+ */
+bool Maze::isExitReachable() const {
+    return isReachable(1, 1, exitX, exitY);
 }
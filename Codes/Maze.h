@@ -3,6 +3,11 @@
 
 #include <vector>
 #include <string>
+#include <cstdint>
+#include "MazeView.h"
+#include "Pathfinder.h"
+#include "MazeGenerator.h"
+#include "Random.h"
 
 /**
  * Maze class managing the 2D grid layout and display
@@ -10,20 +15,42 @@
  */
 class Maze {
 private:
-    static const int MAZE_SIZE = 10;
-    char grid[MAZE_SIZE][MAZE_SIZE];
-    int exitX, exitY;  // Exit position
+    static const int DEFAULT_SIZE = 10;   // Size of the hand-made level 1 layout
+    static const int MAX_SIZE = 4096;     // Largest supported width/height
+    static const int MAX_SWEEP_PASSES = 16;  // Word-parallel fill passes before falling back to a queue
+
+    int width, height;       // Grid dimensions in cells
+    std::vector<char> grid;  // Row-major cells, cell (x, y) lives at y * width + x
+    int exitX, exitY;        // Exit position
+
+    // Bit-packed copy of the grid: one bit per cell, set when the cell is open.
+    // Rows are padded to whole 64-bit words so row y starts at y * wordsPerRow.
+    int wordsPerRow;
+    std::vector<uint64_t> openMask;
+    mutable std::vector<uint64_t> reachMask;  // Scratch buffer for flood fills
+    mutable std::vector<int32_t> reachQueue;  // Scratch queue for the fallback fill
+    mutable Pathfinder pathfinder;            // Scratch search state, not part of the maze itself
+    int repairedWalls;                        // Walls opened by the last ensurePathExists
+    MazeGenerator generator;                  // Scratch state for perfect-maze generation
+    Random random;                            // Generation stream, private to this maze
+
+    void rebuildOpenMask();
+    void floodFrom(int fromX, int fromY, int stopX, int stopY) const;
+    void floodByQueue(int fromX, int fromY) const;
 
 public:
     // Constructor
-    Maze();
+    Maze(int mazeWidth = DEFAULT_SIZE, int mazeHeight = DEFAULT_SIZE);
 
     // Destructor
     ~Maze() = default;
 
     // Grid management
+    void resize(int newWidth, int newHeight);
+    void swap(Maze& other);
+    bool assignCells(const char* cells, int newWidth, int newHeight);
     void initializeDefaultMaze();
-    void initializeMaze(int level);
+    void initializeMaze(int level, MazeAlgorithm algorithm = MazeAlgorithm::ScatteredWalls);
     void display() const;
     void clearScreen() const;
 
@@ -36,16 +63,36 @@ public:
     void setCell(int x, int y, char value);
     bool isValidPosition(int x, int y) const;
     bool isWall(int x, int y) const;
+    bool isOpen(int x, int y) const;
     bool isExit(int x, int y) const;
+    MazeView view() const;
+    const char* getCells() const { return grid.data(); }
+
+    // Reachability (word-parallel flood fill over the open mask)
+    bool isReachable(int fromX, int fromY, int toX, int toY) const;
+    bool isExitReachable() const;
+    void markReachableFrom(int x, int y) const;
+    bool wasReached(int x, int y) const;
+    const uint64_t* getOpenMask() const { return openMask.data(); }
+    const uint64_t* getReachMask() const { return reachMask.data(); }  // Last fill, same layout
+    int getWordsPerRow() const { return wordsPerRow; }
 
     // Utility
     void getExitPosition(int& x, int& y) const;
-    static int getMazeSize() { return MAZE_SIZE; }
+    void setExitPosition(int x, int y);
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getCellCount() const { return width * height; }
+    static int getDefaultSize() { return DEFAULT_SIZE; }
+    static int getMaxSize() { return MAX_SIZE; }
 
     // Level generation
-    void generateLevel(int levelNumber);
+    void generateLevel(int levelNumber, MazeAlgorithm algorithm = MazeAlgorithm::ScatteredWalls);
     void addWalls(int density);
+    void reseed(uint64_t seed) { random.reseed(seed); }
     void ensurePathExists();
+    int getRepairedWallCount() const { return repairedWalls; }
+    int getExitPathLength() const;
 };
 
 #endif // MAZE_H
@@ -0,0 +1,245 @@
+#include "MazeGenerator.h"
+#include <algorithm>
+
+/**
+ * Grid offset of a maze cell
+ * @param cell Maze cell index (row * columns + column)
+ * @param columns Maze cells per row
+ * @param width Grid width in characters
+ * @return Index into the character grid
+ */
+static inline size_t cellOffset(int cell, int columns, int width) {
+    return static_cast<size_t>(2 * (cell / columns) + 1) * width + 2 * (cell % columns) + 1;
+}
+
+/**
+ * Open two neighbouring maze cells and the wall between them
+ * The wall sits exactly halfway between the two cells in the grid
+ */
+static inline void carvePassage(char* cells, int from, int to, int columns, int width) {
+    const size_t a = cellOffset(from, columns, width);
+    const size_t b = cellOffset(to, columns, width);
+    cells[a] = ' ';
+    cells[(a + b) / 2] = ' ';
+    cells[b] = ' ';
+}
+
+/**
+ * Constructor for MazeGenerator class
+ */
+MazeGenerator::MazeGenerator() : columns(0), rows(0) {
+}
+
+/**
+ * Neighbouring maze cell in a direction
+ * @param cell Maze cell index
+ * @param direction 0 up, 1 right, 2 down, 3 left
+ * @return Neighbour index, or -1 past the edge
+ */
+int MazeGenerator::neighbour(int cell, int direction) const {
+    const int column = cell % columns;
+    switch (direction) {
+        case 0:  return cell >= columns ? cell - columns : -1;
+        case 1:  return column + 1 < columns ? cell + 1 : -1;
+        case 2:  return cell + columns < columns * rows ? cell + columns : -1;
+        default: return column > 0 ? cell - 1 : -1;
+    }
+}
+
+/**
+ * Find the representative of a cell's set, halving the path on the way
+ * @param cell Maze cell index
+ * @return Root of the set
+ */
+int MazeGenerator::findSet(int cell) {
+    while (parent[cell] != cell) {
+        parent[cell] = parent[parent[cell]];
+        cell = parent[cell];
+    }
+    return cell;
+}
+
+/**
+ * Carve a perfect maze into a character grid
+ * The whole grid is rewritten: walls everywhere, then the maze. The exit
+ * position is opened and joined to the maze if it falls on a wall
+ * @param cells Row-major grid of width * height characters
+ * @param width Grid width (at least 3)
+ * @param height Grid height (at least 3)
+ * @param algorithm Carving algorithm; ScatteredWalls is not a perfect maze and is rejected
+ * @param exitX Exit X coordinate, inside the border
+ * @param exitY Exit Y coordinate, inside the border
+ * @param random Random stream to carve with
+ * @return true if a maze was carved
+ */
+bool MazeGenerator::generate(char* cells, int width, int height, MazeAlgorithm algorithm,
+                             int exitX, int exitY, Random& random) {
+    if (algorithm == MazeAlgorithm::ScatteredWalls || width < 3 || height < 3) {
+        return false;
+    }
+
+    std::fill(cells, cells + static_cast<size_t>(width) * height, '#');
+    columns = (width - 1) / 2;
+    rows = (height - 1) / 2;
+
+    switch (algorithm) {
+        case MazeAlgorithm::RecursiveBacktracker:
+            carveBacktracker(cells, width, random);
+            break;
+        case MazeAlgorithm::Kruskal:
+            carveKruskal(cells, width, random);
+            break;
+        default:
+            carveWilson(cells, width, random);
+            break;
+    }
+
+    // An exit on even coordinates lies between maze cells; with both even it
+    // needs one more opening to reach the cell diagonally above-left
+    if (exitX % 2 == 0 && exitY % 2 == 0) {
+        cells[static_cast<size_t>(exitY) * width + exitX - 1] = ' ';
+    }
+    cells[static_cast<size_t>(exitY) * width + exitX] = ' ';
+    return true;
+}
+
+/**
+ * Depth-first carving with an explicit stack
+ * Walks to a random unvisited neighbour until stuck, then backs up
+ * @param cells Grid to carve into
+ * @param width Grid width
+ * @param random Random stream to carve with
+ */
+void MazeGenerator::carveBacktracker(char* cells, int width, Random& random) {
+    const int cellCount = columns * rows;
+    visited.assign((static_cast<size_t>(cellCount) + 63) / 64, 0);
+    stack.clear();
+    stack.reserve(cellCount);  // Deepest possible path: no growth while carving
+
+    const int start = random.below(cellCount);
+    markVisited(start);
+    cells[cellOffset(start, columns, width)] = ' ';
+    stack.push_back(start);
+
+    while (!stack.empty()) {
+        const int cell = stack.back();
+        int options[4];
+        int optionCount = 0;
+        for (int direction = 0; direction < 4; direction++) {
+            const int next = neighbour(cell, direction);
+            if (next >= 0 && !isVisited(next)) {
+                options[optionCount++] = next;
+            }
+        }
+
+        if (optionCount == 0) {
+            stack.pop_back();
+            continue;
+        }
+        const int next = options[optionCount == 1 ? 0 : random.below(optionCount)];
+        markVisited(next);
+        carvePassage(cells, cell, next, columns, width);
+        stack.push_back(next);
+    }
+}
+
+/**
+ * Randomised Kruskal: remove walls in random order whenever they separate
+ * two cells that are not yet connected (union-find with path halving and
+ * union by rank)
+ * @param cells Grid to carve into
+ * @param width Grid width
+ * @param random Random stream to carve with
+ */
+void MazeGenerator::carveKruskal(char* cells, int width, Random& random) {
+    const int cellCount = columns * rows;
+    parent.resize(cellCount);
+    scratch.assign(cellCount, 0);
+
+    // Edges are cell * 2 (wall to the right) and cell * 2 + 1 (wall below)
+    stack.clear();
+    stack.reserve(static_cast<size_t>(cellCount) * 2);
+    for (int cell = 0; cell < cellCount; cell++) {
+        parent[cell] = cell;
+        if (cell % columns + 1 < columns) {
+            stack.push_back(cell * 2);
+        }
+        if (cell + columns < cellCount) {
+            stack.push_back(cell * 2 + 1);
+        }
+    }
+    if (cellCount == 1) {
+        cells[cellOffset(0, columns, width)] = ' ';
+        return;
+    }
+
+    // Fisher-Yates shuffle
+    for (int i = static_cast<int>(stack.size()) - 1; i > 0; i--) {
+        std::swap(stack[i], stack[random.below(i + 1)]);
+    }
+
+    int joins = 0;
+    for (size_t i = 0; i < stack.size() && joins < cellCount - 1; i++) {
+        const int cell = stack[i] >> 1;
+        const int next = (stack[i] & 1) ? cell + columns : cell + 1;
+        int a = findSet(cell);
+        int b = findSet(next);
+        if (a == b) {
+            continue;
+        }
+        if (scratch[a] < scratch[b]) {
+            std::swap(a, b);
+        }
+        parent[b] = a;
+        if (scratch[a] == scratch[b]) {
+            scratch[a]++;
+        }
+        carvePassage(cells, cell, next, columns, width);
+        joins++;
+    }
+}
+
+/**
+ * Wilson's algorithm: from each cell not yet in the maze, random walk
+ * until the maze is hit, then carve the walk with its loops erased
+ * Loops are erased for free by remembering only the last direction taken
+ * out of each cell. Produces every perfect maze with equal probability.
+ * @param cells Grid to carve into
+ * @param width Grid width
+ * @param random Random stream to carve with
+ */
+void MazeGenerator::carveWilson(char* cells, int width, Random& random) {
+    const int cellCount = columns * rows;
+    visited.assign((static_cast<size_t>(cellCount) + 63) / 64, 0);
+    scratch.resize(cellCount);
+
+    const int root = random.below(cellCount);
+    markVisited(root);
+    cells[cellOffset(root, columns, width)] = ' ';
+
+    for (int start = 0; start < cellCount; start++) {
+        if (isVisited(start)) {
+            continue;
+        }
+
+        // Walk, recording the exit direction of every cell passed through
+        int cell = start;
+        while (!isVisited(cell)) {
+            int next, direction;
+            do {
+                direction = static_cast<int>(random.next() >> 62);
+                next = neighbour(cell, direction);
+            } while (next < 0);
+            scratch[cell] = static_cast<uint8_t>(direction);
+            cell = next;
+        }
+
+        // Follow the recorded directions from the start: loops are skipped
+        for (cell = start; !isVisited(cell); ) {
+            const int next = neighbour(cell, scratch[cell]);
+            markVisited(cell);
+            carvePassage(cells, cell, next, columns, width);
+            cell = next;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef MAZEGENERATOR_H
+#define MAZEGENERATOR_H
+
+#include "Random.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Layout algorithm used when generating a level
+ */
+enum class MazeAlgorithm {
+    ScatteredWalls,        // Open room with random walls, denser on later levels
+    RecursiveBacktracker,  // Depth-first carving: long winding corridors
+    Kruskal,               // Random spanning tree by merging sets: many short dead ends
+    Wilson                 // Loop-erased random walks: uniformly random perfect maze
+};
+
+/**
+ * MazeGenerator class carving perfect mazes (exactly one path between any
+ * two open cells) into a character grid
+ * Maze cells sit on odd coordinates and the walls between them on the
+ * even coordinates in between; with an even width or height the last
+ * column or row stays solid. None of the algorithms recurse, and all
+ * working memory is kept between calls, so regenerating a maze of the
+ * same size allocates nothing.
+ */
+class MazeGenerator {
+private:
+    int columns, rows;                 // Maze cells across and down
+    std::vector<uint64_t> visited;     // One bit per maze cell (backtracker, Wilson)
+    std::vector<int32_t> stack;        // Backtracker path, or Kruskal's shuffled edges
+    std::vector<int32_t> parent;       // Kruskal union-find parents
+    std::vector<uint8_t> scratch;      // Kruskal set ranks, or Wilson walk directions
+
+    bool isVisited(int cell) const { return (visited[cell >> 6] >> (cell & 63)) & 1; }
+    void markVisited(int cell) { visited[cell >> 6] |= uint64_t(1) << (cell & 63); }
+    int findSet(int cell);
+    int neighbour(int cell, int direction) const;
+
+    void carveBacktracker(char* cells, int width, Random& random);
+    void carveKruskal(char* cells, int width, Random& random);
+    void carveWilson(char* cells, int width, Random& random);
+
+public:
+    // Constructor
+    MazeGenerator();
+
+    // Destructor
+    ~MazeGenerator() = default;
+
+    // Generation
+    bool generate(char* cells, int width, int height, MazeAlgorithm algorithm,
+                  int exitX, int exitY, Random& random);
+};
+
+#endif // MAZEGENERATOR_H
@@ -0,0 +1,53 @@
+#ifndef MAZEVIEW_H
+#define MAZEVIEW_H
+
+#include <cstdint>
+
+/**
+ * MazeView class giving read-only, non-owning access to a maze's storage
+ * Wraps the row-major character grid and the bit-packed open mask with
+ * their bounds, so movement checks can read cells directly without
+ * copying the grid or going through Maze's out-of-line accessors.
+ * A view stays valid until the maze it came from is resized or destroyed.
+ */
+class MazeView {
+private:
+    const char* cells;         // Row-major characters, width per row
+    const uint64_t* openMask;  // One bit per cell, wordsPerRow words per row
+    int width, height;         // Grid dimensions in cells
+    int wordsPerRow;           // 64-bit words per open-mask row
+
+public:
+    // Constructor
+    MazeView(const char* gridCells, const uint64_t* gridOpenMask,
+             int gridWidth, int gridHeight, int gridWordsPerRow)
+        : cells(gridCells), openMask(gridOpenMask),
+          width(gridWidth), height(gridHeight), wordsPerRow(gridWordsPerRow) {}
+
+    // Getters
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    // Grid access
+    bool isValidPosition(int x, int y) const {
+        return static_cast<unsigned>(x) < static_cast<unsigned>(width) &&
+               static_cast<unsigned>(y) < static_cast<unsigned>(height);
+    }
+
+    char getCell(int x, int y) const {
+        return isValidPosition(x, y) ? cells[y * width + x] : '#';
+    }
+
+    const char* getRow(int y) const { return cells + y * width; }
+    const uint64_t* getMaskRow(int y) const { return openMask + y * wordsPerRow; }
+    int getWordsPerRow() const { return wordsPerRow; }
+
+    bool isOpen(int x, int y) const {
+        return isValidPosition(x, y) &&
+               ((openMask[y * wordsPerRow + (x >> 6)] >> (x & 63)) & 1);
+    }
+
+    bool isWall(int x, int y) const { return !isOpen(x, y); }
+};
+
+#endif // MAZEVIEW_H
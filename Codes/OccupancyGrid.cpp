@@ -0,0 +1,240 @@
+#include "OccupancyGrid.h"
+#include "Maze.h"
+#include "Random.h"
+#include <algorithm>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+/**
+ * Index of the lowest set bit
+ * @param bits Non-zero word
+ * @return Bit position (0-63)
+ */
+static inline int lowestBit(uint64_t bits) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+/**
+ * Number of set bits
+ * @param bits Word to count
+ * @return Set bits (0-64)
+ */
+static inline int countBits(uint64_t bits) {
+#ifdef _MSC_VER
+    return static_cast<int>(__popcnt64(bits));
+#else
+    return __builtin_popcountll(bits);
+#endif
+}
+
+/**
+ * Constructor for OccupancyGrid class
+ * Starts empty; call reset before use
+ */
+OccupancyGrid::OccupancyGrid() : width(0), height(0), freeCount(0), reachableFreeCount(0) {
+}
+
+/**
+ * Clear the index and size it for a maze and a number of collectibles
+ * Storage is reused when the dimensions do not change
+ * @param newWidth Maze width in cells
+ * @param newHeight Maze height in cells
+ * @param collectibleCount Number of collectibles that may be added
+ */
+void OccupancyGrid::reset(int newWidth, int newHeight, int collectibleCount) {
+    width = newWidth;
+    height = newHeight;
+
+    const size_t cells = static_cast<size_t>(width) * height;
+    enemyCounts.assign(cells, 0);
+    collectibleHeads.assign(cells, -1);
+    collectibleNext.assign(collectibleCount, -1);
+}
+
+/**
+ * Exchange contents with another index (constant time)
+ * @param other Index to swap with
+ */
+void OccupancyGrid::swap(OccupancyGrid& other) {
+    std::swap(width, other.width);
+    std::swap(height, other.height);
+    enemyCounts.swap(other.enemyCounts);
+    collectibleHeads.swap(other.collectibleHeads);
+    collectibleNext.swap(other.collectibleNext);
+    freeCells.swap(other.freeCells);
+    std::swap(freeCount, other.freeCount);
+    std::swap(reachableFreeCount, other.reachableFreeCount);
+}
+
+/**
+ * Size the collectible chains without touching the per-cell index
+ * For callers that have already emptied the index entity by entity,
+ * which is far cheaper than reset on a large maze
+ * @param collectibleCount Number of collectibles that may be added
+ */
+void OccupancyGrid::resizeCollectibles(int collectibleCount) {
+    collectibleNext.assign(collectibleCount, -1);
+}
+
+/**
+ * Record an enemy standing on a cell
+ * @param x X coordinate
+ * @param y Y coordinate
+ */
+void OccupancyGrid::addEnemy(int x, int y) {
+    enemyCounts[y * width + x]++;
+}
+
+/**
+ * Forget an enemy standing on a cell
+ * @param x X coordinate
+ * @param y Y coordinate
+ */
+void OccupancyGrid::removeEnemy(int x, int y) {
+    uint16_t& count = enemyCounts[y * width + x];
+    if (count > 0) {
+        count--;
+    }
+}
+
+/**
+ * Move an enemy from one cell to another
+ * @param fromX Previous X coordinate
+ * @param fromY Previous Y coordinate
+ * @param toX New X coordinate
+ * @param toY New Y coordinate
+ */
+void OccupancyGrid::moveEnemy(int fromX, int fromY, int toX, int toY) {
+    removeEnemy(fromX, fromY);
+    addEnemy(toX, toY);
+}
+
+/**
+ * Record an uncollected collectible on a cell
+ * @param index Index of the collectible in the game's collectible list
+ * @param x X coordinate
+ * @param y Y coordinate
+ */
+void OccupancyGrid::addCollectible(int index, int x, int y) {
+    if (index >= static_cast<int>(collectibleNext.size())) {
+        collectibleNext.resize(index + 1, -1);
+    }
+
+    int32_t& head = collectibleHeads[y * width + x];
+    collectibleNext[index] = head;
+    head = index;
+}
+
+/**
+ * Remove every collectible on a cell (after they have been collected)
+ * @param x X coordinate
+ * @param y Y coordinate
+ */
+void OccupancyGrid::clearCollectibles(int x, int y) {
+    collectibleHeads[y * width + x] = -1;
+}
+
+/**
+ * List the cells entities can be placed on
+ * Every open cell except the start and the exit, with the cells reachable
+ * from the start first. Works from the maze's open mask and reachability
+ * fill a word at a time, so walls cost nothing beyond their share of a
+ * word and the list is written in place without growing.
+ * @param maze Maze the entities go into (its reachability fill is replaced)
+ * @param startX Start X coordinate (kept free)
+ * @param startY Start Y coordinate (kept free)
+ */
+void OccupancyGrid::indexFreeCells(const Maze& maze, int startX, int startY) {
+    maze.markReachableFrom(startX, startY);
+
+    int exitX, exitY;
+    maze.getExitPosition(exitX, exitY);
+    const int mazeWidth = maze.getWidth();
+    const int wordsPerRow = maze.getWordsPerRow();
+    const size_t words = static_cast<size_t>(maze.getHeight()) * wordsPerRow;
+    const uint64_t* openMask = maze.getOpenMask();
+    const uint64_t* reachMask = maze.getReachMask();
+
+    // Size the two groups first: reachable cells fill the list from the
+    // front, the rest fill it from the back
+    int openCells = 0, reachableCells = 0;
+    for (size_t i = 0; i < words; i++) {
+        openCells += countBits(openMask[i]);
+        reachableCells += countBits(reachMask[i] & openMask[i]);
+    }
+    const bool startOpen = maze.isOpen(startX, startY);
+    const bool exitOpen = maze.isOpen(exitX, exitY) && !(exitX == startX && exitY == startY);
+    openCells -= (startOpen ? 1 : 0) + (exitOpen ? 1 : 0);
+    reachableCells -= (startOpen ? 1 : 0) + (exitOpen && maze.wasReached(exitX, exitY) ? 1 : 0);
+    freeCells.resize(openCells);
+
+    const int32_t startCell = startY * mazeWidth + startX;
+    const int32_t exitCell = exitY * mazeWidth + exitX;
+    int front = 0, back = openCells;
+    for (int y = 0; y < maze.getHeight(); y++) {
+        for (int word = 0; word < wordsPerRow; word++) {
+            const size_t i = static_cast<size_t>(y) * wordsPerRow + word;
+            const int32_t rowCell = y * mazeWidth + word * 64;
+            uint64_t reached = reachMask[i] & openMask[i];
+            uint64_t unreached = openMask[i] & ~reachMask[i];
+            while (reached != 0) {
+                const int32_t cell = rowCell + lowestBit(reached);
+                reached &= reached - 1;
+                if (cell != startCell && cell != exitCell) {
+                    freeCells[front++] = cell;
+                }
+            }
+            while (unreached != 0) {
+                const int32_t cell = rowCell + lowestBit(unreached);
+                unreached &= unreached - 1;
+                if (cell != startCell && cell != exitCell) {
+                    freeCells[--back] = cell;
+                }
+            }
+        }
+    }
+
+    freeCount = openCells;
+    reachableFreeCount = reachableCells;
+}
+
+/**
+ * Draw a random free cell and mark it taken
+ * One step of a Fisher-Yates shuffle: the drawn cell is swapped to the
+ * end of the free cells (leaving the reachable cells in front) and the
+ * list shrinks by one
+ * @param random Random stream choosing the cell
+ * @param reachableOnly Only draw cells reachable from the start
+ * @param x Receives the X coordinate
+ * @param y Receives the Y coordinate
+ * @return false if no suitable cell is left
+ */
+bool OccupancyGrid::takeFreeCell(Random& random, bool reachableOnly, int& x, int& y) {
+    const int candidates = reachableOnly ? reachableFreeCount : freeCount;
+    if (candidates == 0) {
+        return false;
+    }
+
+    int chosen = random.below(candidates);
+    const int32_t cell = freeCells[chosen];
+    if (chosen < reachableFreeCount) {
+        // Close the gap in the reachable cells with the last of them
+        reachableFreeCount--;
+        std::swap(freeCells[chosen], freeCells[reachableFreeCount]);
+        chosen = reachableFreeCount;
+    }
+    freeCount--;
+    std::swap(freeCells[chosen], freeCells[freeCount]);
+
+    x = cell % width;
+    y = cell / width;
+    return true;
+}
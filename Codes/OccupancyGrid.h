@@ -0,0 +1,67 @@
+#ifndef OCCUPANCYGRID_H
+#define OCCUPANCYGRID_H
+
+#include <vector>
+#include <cstdint>
+
+class Maze;
+class Random;
+
+/**
+ * OccupancyGrid class indexing which entities stand on each maze cell
+ * Keeps a per-cell enemy count and a per-cell list of uncollected
+ * collectibles, so collision checks and rendering can look up a cell
+ * directly instead of scanning every entity.
+ *
+ * For placing a level's entities it also keeps the opposite index: a
+ * list of the open cells nothing has been put on yet, with the cells
+ * reachable from the start at the front. Cells are drawn from it without
+ * replacement, so every placement costs O(1) and no two entities are
+ * placed on the same cell.
+ */
+class OccupancyGrid {
+private:
+    int width, height;                      // Grid dimensions in cells
+    std::vector<uint16_t> enemyCounts;      // Enemies standing on each cell
+    std::vector<int32_t> collectibleHeads;  // First collectible on each cell, -1 if none
+    std::vector<int32_t> collectibleNext;   // Next collectible on the same cell, -1 at the end
+
+    // Free cells for placement: cells [0, freeCount) are still free, and
+    // the first reachableFreeCount of them are reachable from the start
+    std::vector<int32_t> freeCells;
+    int freeCount;
+    int reachableFreeCount;
+
+public:
+    // Constructor
+    OccupancyGrid();
+
+    // Destructor
+    ~OccupancyGrid() = default;
+
+    // Setup
+    void reset(int newWidth, int newHeight, int collectibleCount);
+    void resizeCollectibles(int collectibleCount);
+    void swap(OccupancyGrid& other);
+
+    // Enemy tracking
+    void addEnemy(int x, int y);
+    void removeEnemy(int x, int y);
+    void moveEnemy(int fromX, int fromY, int toX, int toY);
+    bool hasEnemy(int x, int y) const { return enemyCounts[y * width + x] != 0; }
+
+    // Collectible tracking
+    void addCollectible(int index, int x, int y);
+    void clearCollectibles(int x, int y);
+    bool hasCollectible(int x, int y) const { return collectibleHeads[y * width + x] >= 0; }
+    int firstCollectible(int x, int y) const { return collectibleHeads[y * width + x]; }
+    int nextCollectible(int index) const { return collectibleNext[index]; }
+
+    // Free cells for entity placement
+    void indexFreeCells(const Maze& maze, int startX, int startY);
+    bool takeFreeCell(Random& random, bool reachableOnly, int& x, int& y);
+    int getFreeCellCount() const { return freeCount; }
+    int getReachableFreeCellCount() const { return reachableFreeCount; }
+};
+
+#endif // OCCUPANCYGRID_H
@@ -0,0 +1,465 @@
+#include "Pathfinder.h"
+#include <algorithm>
+#include <cstdlib>
+
+#ifdef _MSC_VER
+    #include <intrin.h>
+#endif
+
+const int Pathfinder::NO_PATH;
+
+/**
+ * Index of the lowest set bit
+ * @param bits Non-zero word
+ * @return Bit position (0-63)
+ */
+static inline int lowestBit(uint64_t bits) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(bits);
+#endif
+}
+
+/**
+ * Index of the highest set bit
+ * @param bits Non-zero word
+ * @return Bit position (0-63)
+ */
+static inline int highestBit(uint64_t bits) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, bits);
+    return static_cast<int>(index);
+#else
+    return 63 - __builtin_clzll(bits);
+#endif
+}
+
+/**
+ * Order for the open list heap: smallest estimate on top, then smallest heuristic
+ */
+struct OpenNodeAfter {
+    template <typename Node>
+    bool operator()(const Node& a, const Node& b) const {
+        return a.estimate != b.estimate ? a.estimate > b.estimate : a.heuristic > b.heuristic;
+    }
+};
+
+/**
+ * Constructor for Pathfinder class
+ */
+Pathfinder::Pathfinder()
+    : width(0), height(0), currentStamp(0), startCell(-1), goalCell(-1), found(false),
+      expandedCount(0), jumpMaze(nullptr), goalX(0), goalY(0) {
+}
+
+/**
+ * Size the working memory for a maze and start a new search
+ * @param maze Maze about to be searched
+ */
+void Pathfinder::prepare(const MazeView& maze) {
+    const size_t cells = static_cast<size_t>(maze.getWidth()) * maze.getHeight();
+    if (cells > stamp.size()) {
+        cost.resize(cells);
+        parent.resize(cells);
+        stamp.assign(cells, 0);
+        currentStamp = 0;
+        queue.reserve(cells);
+        openList.reserve(cells);
+    }
+    width = maze.getWidth();
+    height = maze.getHeight();
+
+    if (++currentStamp == 0) {
+        // Search number wrapped around: old tags could look current again
+        std::fill(stamp.begin(), stamp.end(), 0);
+        currentStamp = 1;
+    }
+    closed.assign((cells + 63) / 64, 0);
+    openList.clear();
+    queue.clear();
+    found = false;
+    expandedCount = 0;
+}
+
+/**
+ * Record a cheaper way to reach a cell
+ * @param cell Cell index
+ * @param newCost Cost via the new route
+ * @param from Previous cell on the new route
+ * @return true if the new route is better than any known one
+ */
+bool Pathfinder::relax(int cell, uint32_t newCost, int from) {
+    if (isKnown(cell) && cost[cell] <= newCost) {
+        return false;
+    }
+    stamp[cell] = currentStamp;
+    cost[cell] = newCost;
+    parent[cell] = from;
+    return true;
+}
+
+/**
+ * Put a cell on the open list using its current cost
+ * @param cell Cell index
+ * @param x Cell X coordinate
+ * @param y Cell Y coordinate
+ */
+void Pathfinder::pushOpen(int cell, int x, int y) {
+    OpenNode node;
+    node.heuristic = static_cast<uint32_t>(std::abs(x - goalX) + std::abs(y - goalY));
+    node.estimate = cost[cell] + node.heuristic;
+    node.cell = cell;
+    openList.push_back(node);
+    std::push_heap(openList.begin(), openList.end(), OpenNodeAfter());
+}
+
+/**
+ * Find a shortest path between two cells
+ * @param maze Maze to search
+ * @param fromX Start X coordinate
+ * @param fromY Start Y coordinate
+ * @param toX Goal X coordinate
+ * @param toY Goal Y coordinate
+ * @param algorithm Search strategy (all return the same length)
+ * @return Path length in steps, or NO_PATH
+ */
+int Pathfinder::findPath(const MazeView& maze, int fromX, int fromY, int toX, int toY, PathAlgorithm algorithm) {
+    prepare(maze);
+    if (!maze.isOpen(fromX, fromY) || !maze.isOpen(toX, toY)) {
+        return NO_PATH;
+    }
+
+    startCell = fromY * width + fromX;
+    goalCell = toY * width + toX;
+    goalX = toX;
+    goalY = toY;
+    relax(startCell, 0, -1);
+
+    switch (algorithm) {
+        case PathAlgorithm::BreadthFirst:
+            searchBreadthFirst(maze);
+            break;
+        case PathAlgorithm::AStar:
+            searchAStar(maze);
+            break;
+        case PathAlgorithm::JumpPoint:
+            searchJumpPoint(maze);
+            break;
+    }
+    return found ? static_cast<int>(cost[goalCell]) : NO_PATH;
+}
+
+/**
+ * Plain breadth-first search from startCell
+ * @param maze Maze to search
+ */
+void Pathfinder::searchBreadthFirst(const MazeView& maze) {
+    queue.push_back(startCell);
+    for (size_t head = 0; head < queue.size(); head++) {
+        const int cell = queue[head];
+        expandedCount++;
+        if (cell == goalCell) {
+            found = true;
+            return;
+        }
+
+        const int x = cell % width;
+        const int y = cell / width;
+        const uint32_t next = cost[cell] + 1;
+        if (maze.isOpen(x, y - 1) && !isKnown(cell - width)) { relax(cell - width, next, cell); queue.push_back(cell - width); }
+        if (maze.isOpen(x + 1, y) && !isKnown(cell + 1))     { relax(cell + 1, next, cell);     queue.push_back(cell + 1); }
+        if (maze.isOpen(x, y + 1) && !isKnown(cell + width)) { relax(cell + width, next, cell); queue.push_back(cell + width); }
+        if (maze.isOpen(x - 1, y) && !isKnown(cell - 1))     { relax(cell - 1, next, cell);     queue.push_back(cell - 1); }
+    }
+}
+
+/**
+ * A* search from startCell with the Manhattan distance heuristic
+ * @param maze Maze to search
+ */
+void Pathfinder::searchAStar(const MazeView& maze) {
+    static const int directionX[4] = {0, 1, 0, -1};
+    static const int directionY[4] = {-1, 0, 1, 0};
+
+    pushOpen(startCell, startCell % width, startCell / width);
+    while (!openList.empty()) {
+        const int cell = openList.front().cell;
+        std::pop_heap(openList.begin(), openList.end(), OpenNodeAfter());
+        openList.pop_back();
+        if (isClosed(cell)) {
+            continue; // Stale entry, a cheaper one was expanded already
+        }
+        close(cell);
+        expandedCount++;
+        if (cell == goalCell) {
+            found = true;
+            return;
+        }
+
+        const int x = cell % width;
+        const int y = cell / width;
+        for (int d = 0; d < 4; d++) {
+            const int nx = x + directionX[d];
+            const int ny = y + directionY[d];
+            const int neighbour = ny * width + nx;
+            if (maze.isOpen(nx, ny) && !isClosed(neighbour) && relax(neighbour, cost[cell] + 1, cell)) {
+                pushOpen(neighbour, nx, ny);
+            }
+        }
+    }
+}
+
+/**
+ * Jump point search from startCell
+ *
+ * Only paths in a canonical form are followed: vertical runs may turn
+ * horizontal anywhere, but a horizontal run only turns vertical where it
+ * is forced to (the cell diagonally behind is a wall, so the turn could
+ * not have been taken one step earlier). Every shortest path has a
+ * canonical twin of the same length, so the result is still optimal.
+ * Horizontal scans read the open bitmask 64 cells at a time.
+ * @param maze Maze to search
+ */
+void Pathfinder::searchJumpPoint(const MazeView& maze) {
+    jumpMaze = &maze;
+    pushOpen(startCell, startCell % width, startCell / width);
+
+    while (!openList.empty()) {
+        const int cell = openList.front().cell;
+        std::pop_heap(openList.begin(), openList.end(), OpenNodeAfter());
+        openList.pop_back();
+        if (isClosed(cell)) {
+            continue;
+        }
+        close(cell);
+        expandedCount++;
+        if (cell == goalCell) {
+            found = true;
+            break;
+        }
+
+        const int x = cell % width;
+        const int y = cell / width;
+        const int from = parent[cell];
+        const int fromX = from < 0 ? x : from % width;
+        const int fromY = from < 0 ? y : from / width;
+        const int dx = (x > fromX) - (x < fromX);
+        const int dy = (y > fromY) - (y < fromY);
+
+        // Successor jump points: {x, y} of each, -1 when a direction leads nowhere
+        int successors[4];
+        int successorCount = 0;
+        if (from < 0 || dy != 0) {
+            // Start, or arrived vertically: keep going and branch both ways horizontally
+            if (from < 0) {
+                successors[successorCount++] = jumpVertical(x, y, -1);
+                successors[successorCount++] = jumpVertical(x, y, 1);
+            } else {
+                successors[successorCount++] = jumpVertical(x, y, dy);
+            }
+            successors[successorCount++] = jumpHorizontal(x, y, 1);
+            successors[successorCount++] = jumpHorizontal(x, y, -1);
+        } else {
+            // Arrived horizontally: keep going, and turn only where forced
+            successors[successorCount++] = jumpHorizontal(x, y, dx);
+            for (int turn = -1; turn <= 1; turn += 2) {
+                if (maze.isOpen(x, y + turn) && !maze.isOpen(x - dx, y + turn)) {
+                    successors[successorCount++] = jumpVertical(x, y, turn);
+                }
+            }
+        }
+
+        for (int i = 0; i < successorCount; i++) {
+            const int next = successors[i];
+            if (next < 0 || isClosed(next)) {
+                continue;
+            }
+            const int nx = next % width;
+            const int ny = next / width;
+            const uint32_t distance = static_cast<uint32_t>(std::abs(nx - x) + std::abs(ny - y));
+            if (relax(next, cost[cell] + distance, cell)) {
+                pushOpen(next, nx, ny);
+            }
+        }
+    }
+    jumpMaze = nullptr;
+}
+
+/**
+ * Scan along a row for the next jump point
+ * A jump point is the goal or a cell with a forced vertical turn: the cell
+ * above (or below) is open while the one behind it is a wall
+ * @param x Starting X coordinate (not itself considered)
+ * @param y Row
+ * @param dx Direction, +1 or -1
+ * @return Cell index of the jump point, or -1 if a wall comes first
+ */
+int Pathfinder::jumpHorizontal(int x, int y, int dx) const {
+    const int start = x + dx;
+    if (start < 0 || start >= width) {
+        return -1;
+    }
+
+    const int words = jumpMaze->getWordsPerRow();
+    const uint64_t* row = jumpMaze->getMaskRow(y);
+    const uint64_t* above = y > 0 ? jumpMaze->getMaskRow(y - 1) : nullptr;
+    const uint64_t* below = y < height - 1 ? jumpMaze->getMaskRow(y + 1) : nullptr;
+    const int firstWord = start >> 6;
+
+    for (int w = firstWord; w >= 0 && w < words; w += dx) {
+        const uint64_t open = row[w];  // Bits past the maze width are 0, i.e. walls
+        uint64_t forced = 0;
+        for (int side = 0; side < 2; side++) {
+            const uint64_t* neighbourRow = side == 0 ? above : below;
+            if (!neighbourRow) {
+                continue;
+            }
+            const uint64_t bits = neighbourRow[w];
+            // Bit i of behind: the neighbour-row cell one step back from cell i
+            uint64_t behind;
+            if (dx > 0) {
+                behind = (bits << 1) | (w > 0 ? neighbourRow[w - 1] >> 63 : 0);
+            } else {
+                behind = (bits >> 1) | (w + 1 < words ? neighbourRow[w + 1] << 63 : 0);
+            }
+            forced |= bits & ~behind;
+        }
+        if (y == goalY && (goalX >> 6) == w) {
+            forced |= uint64_t(1) << (goalX & 63);
+        }
+
+        uint64_t stops = (forced & open) | ~open;
+        if (w == firstWord) {
+            const int bit = start & 63;
+            stops &= dx > 0 ? ~uint64_t(0) << bit : ~uint64_t(0) >> (63 - bit);
+        }
+        if (stops) {
+            const int bit = dx > 0 ? lowestBit(stops) : highestBit(stops);
+            return ((open >> bit) & 1) ? y * width + w * 64 + bit : -1;
+        }
+    }
+    return -1;
+}
+
+/**
+ * Walk along a column for the next jump point
+ * A cell is a jump point if it is the goal or if a horizontal scan from it
+ * finds a jump point
+ * @param x Column
+ * @param y Starting Y coordinate (not itself considered)
+ * @param dy Direction, +1 or -1
+ * @return Cell index of the jump point, or -1 if a wall comes first
+ */
+int Pathfinder::jumpVertical(int x, int y, int dy) const {
+    for (y += dy; jumpMaze->isOpen(x, y); y += dy) {
+        if ((x == goalX && y == goalY) || jumpHorizontal(x, y, 1) >= 0 || jumpHorizontal(x, y, -1) >= 0) {
+            return y * width + x;
+        }
+    }
+    return -1;
+}
+
+/**
+ * List the cells of the path found by the last successful findPath
+ * Jump point paths are expanded back into single steps
+ * @param cells Receives cell indices (y * width + x) from start to goal
+ */
+void Pathfinder::tracePath(std::vector<int32_t>& cells) const {
+    cells.clear();
+    if (!found) {
+        return;
+    }
+    for (int cell = goalCell; cell >= 0; cell = parent[cell]) {
+        cells.push_back(cell);
+        const int previous = parent[cell];
+        if (previous < 0) {
+            break;
+        }
+        // Fill in the straight run between jump points (empty for single steps)
+        const int step = (previous / width == cell / width) ? (previous > cell ? 1 : -1)
+                                                             : (previous > cell ? width : -width);
+        for (int between = cell + step; between != previous; between += step) {
+            cells.push_back(between);
+        }
+    }
+    std::reverse(cells.begin(), cells.end());
+}
+
+/**
+ * Find the fewest interior walls to open so that two cells connect
+ * A 0-1 breadth-first search: stepping onto an open cell is free, onto a
+ * wall costs one. Border cells are never used. The walls on the cheapest
+ * route are left in getRepairCells().
+ * @param maze Maze to search
+ * @param fromX Start X coordinate
+ * @param fromY Start Y coordinate
+ * @param toX Goal X coordinate
+ * @param toY Goal Y coordinate
+ * @return Number of walls to open (0 if already connected), or NO_PATH
+ */
+int Pathfinder::findMinimalRepair(const MazeView& maze, int fromX, int fromY, int toX, int toY) {
+    static const int directionX[4] = {0, 1, 0, -1};
+    static const int directionY[4] = {-1, 0, 1, 0};
+
+    prepare(maze);
+    repairCells.clear();
+    auto isInterior = [this](int x, int y) { return x > 0 && y > 0 && x < width - 1 && y < height - 1; };
+    if (!isInterior(fromX, fromY) || !isInterior(toX, toY)) {
+        return NO_PATH;
+    }
+
+    startCell = fromY * width + fromX;
+    goalCell = toY * width + toX;
+    const bool startOpen = maze.isOpen(fromX, fromY);
+    relax(startCell, startOpen ? 0 : 1, -1);
+    nextLayer.clear();
+    (startOpen ? queue : nextLayer).push_back(startCell);
+
+    // queue holds cells reached with the current number of walls opened,
+    // nextLayer those needing one more
+    while (!found && (!queue.empty() || !nextLayer.empty())) {
+        for (size_t head = 0; head < queue.size(); head++) {
+            const int cell = queue[head];
+            if (isClosed(cell)) {
+                continue; // Reached again more cheaply after being queued
+            }
+            close(cell);
+            expandedCount++;
+            if (cell == goalCell) {
+                found = true;
+                break;
+            }
+
+            const int x = cell % width;
+            const int y = cell / width;
+            for (int d = 0; d < 4; d++) {
+                const int nx = x + directionX[d];
+                const int ny = y + directionY[d];
+                const int neighbour = ny * width + nx;
+                if (!isInterior(nx, ny) || isClosed(neighbour)) {
+                    continue;
+                }
+                const bool open = maze.isOpen(nx, ny);
+                if (relax(neighbour, cost[cell] + (open ? 0 : 1), cell)) {
+                    (open ? queue : nextLayer).push_back(neighbour);
+                }
+            }
+        }
+        queue.swap(nextLayer);
+        nextLayer.clear();
+    }
+
+    if (!found) {
+        return NO_PATH;
+    }
+    for (int cell = goalCell; cell >= 0; cell = parent[cell]) {
+        if (!maze.isOpen(cell % width, cell / width)) {
+            repairCells.push_back(cell);
+        }
+    }
+    return static_cast<int>(cost[goalCell]);
+}
@@ -0,0 +1,90 @@
+#ifndef PATHFINDER_H
+#define PATHFINDER_H
+
+#include "MazeView.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Search strategy used by Pathfinder::findPath
+ */
+enum class PathAlgorithm {
+    BreadthFirst,  // Uniform expansion; also the reference result
+    AStar,         // Best-first on cost plus Manhattan distance
+    JumpPoint      // A* over jump points only (4-connected jump point search)
+};
+
+/**
+ * Pathfinder class finding shortest 4-connected paths through a maze
+ * All working memory (per-cell costs and parents, the closed bitmap, the
+ * open list heap and the queues) is kept between searches and only grows,
+ * so repeated searches on one maze size do not allocate. Per-cell costs
+ * are tagged with a search number instead of being cleared, so a search
+ * only pays for the cells it touches (plus clearing the closed bitmap,
+ * one bit per cell).
+ */
+class Pathfinder {
+public:
+    static const int NO_PATH = -1;
+
+private:
+    /**
+     * Entry of the open list heap
+     */
+    struct OpenNode {
+        uint32_t estimate;   // Cost so far plus heuristic
+        uint32_t heuristic;  // Heuristic alone, to break ties towards the goal
+        int32_t cell;
+    };
+
+    int width, height;
+    std::vector<uint32_t> cost;       // Steps (or walls opened) from the start per cell
+    std::vector<int32_t> parent;      // Previous cell on the best known path (previous jump point for JPS)
+    std::vector<uint32_t> stamp;      // Search that last wrote cost/parent for each cell
+    uint32_t currentStamp;
+    std::vector<uint64_t> closed;     // Closed set, one bit per cell
+    std::vector<OpenNode> openList;   // Binary min-heap on estimate
+    std::vector<int32_t> queue;       // Breadth-first queue / current repair layer
+    std::vector<int32_t> nextLayer;   // Next repair layer
+    std::vector<int32_t> repairCells; // Walls to open, from the last findMinimalRepair
+    int startCell, goalCell;          // Endpoints of the last search
+    bool found;                       // Whether the last search reached the goal
+    int expandedCount;                // Cells expanded by the last search
+
+    // Jump point search state for the current search
+    const MazeView* jumpMaze;
+    int goalX, goalY;
+
+    void prepare(const MazeView& maze);
+    bool isKnown(int cell) const { return stamp[cell] == currentStamp; }
+    bool isClosed(int cell) const { return (closed[cell >> 6] >> (cell & 63)) & 1; }
+    void close(int cell) { closed[cell >> 6] |= uint64_t(1) << (cell & 63); }
+    bool relax(int cell, uint32_t newCost, int from);
+    void pushOpen(int cell, int x, int y);
+
+    void searchBreadthFirst(const MazeView& maze);
+    void searchAStar(const MazeView& maze);
+    void searchJumpPoint(const MazeView& maze);
+    int jumpHorizontal(int x, int y, int dx) const;
+    int jumpVertical(int x, int y, int dy) const;
+
+public:
+    // Constructor
+    Pathfinder();
+
+    // Destructor
+    ~Pathfinder() = default;
+
+    // Searching
+    int findPath(const MazeView& maze, int fromX, int fromY, int toX, int toY,
+                 PathAlgorithm algorithm = PathAlgorithm::JumpPoint);
+    void tracePath(std::vector<int32_t>& cells) const;
+    int getExpandedCount() const { return expandedCount; }
+
+    // Repair
+    int findMinimalRepair(const MazeView& maze, int fromX, int fromY, int toX, int toY);
+    const std::vector<int32_t>& getRepairCells() const { return repairCells; }
+};
+
+#endif // PATHFINDER_H
@@ -82,15 +82,15 @@ void Player::draw() const {
  * Check if player can move to a specific position
  * @param newX Target X position
  * @param newY Target Y position
- * @param maze The maze grid to check against
+ * @param maze Read-only view of the maze to check against
  * @return true if movement is valid, false otherwise
  */
-bool Player::canMoveTo(int newX, int newY, const char maze[10][10]) const {
+bool Player::canMoveTo(int newX, int newY, const MazeView& maze) const {
     // Check bounds
-    if (newX < 0 || newX >= 10 || newY < 0 || newY >= 10) {
+    if (!maze.isValidPosition(newX, newY)) {
         return false;
     }
 
     // Check if target position is not a wall
-    return maze[newY][newX] != '#';
+    return !maze.isWall(newX, newY);
 }
@@ -3,6 +3,8 @@
 
 #include "Entity.h"
 
+#include "MazeView.h"
+
 /**
  * Player class representing the game player
  * Handles movement and score tracking
@@ -36,7 +38,7 @@ public:
     void draw() const override;
 
     // Movement validation
-    bool canMoveTo(int newX, int newY, const char maze[10][10]) const;
+    bool canMoveTo(int newX, int newY, const MazeView& maze) const;
 };
 
 #endif // PLAYER_H
@@ -0,0 +1,52 @@
+#include "Random.h"
+#include <chrono>
+
+const uint64_t Random::DEFAULT_SEED;
+
+/**
+ * One splitmix64 step: advance a counter and scramble it
+ * @param counter Counter to advance
+ * @return Well-mixed 64-bit value
+ */
+static uint64_t splitMix(uint64_t& counter) {
+    uint64_t z = (counter += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/**
+ * Restart the sequence from a seed
+ * @param seed Any 64-bit value, zero included
+ */
+void Random::reseed(uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        state[i] = splitMix(seed);
+    }
+}
+
+/**
+ * Seed for one stream of a seeded game
+ * Different streams, or different indices (e.g. level numbers) within a
+ * stream, give unrelated sequences, so consuming more numbers in one
+ * never shifts another
+ * @param seed Game seed
+ * @param stream Which stream
+ * @param index Sub-stream number, e.g. the level
+ * @return Seed for a Random instance
+ */
+uint64_t Random::deriveSeed(uint64_t seed, RandomStream stream, uint64_t index) {
+    uint64_t counter = seed;
+    uint64_t mixed = splitMix(counter) ^ static_cast<uint64_t>(stream);
+    mixed = splitMix(mixed) ^ index;
+    return splitMix(mixed);
+}
+
+/**
+ * Seed for an unseeded game, taken from the high-resolution clock
+ * @return Seed that differs from run to run
+ */
+uint64_t Random::seedFromClock() {
+    uint64_t counter = static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return splitMix(counter);
+}
@@ -0,0 +1,67 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+/**
+ * Independent random streams derived from one game seed
+ */
+enum class RandomStream : uint64_t {
+    Generation = 1,  // Maze layouts
+    Placement = 2,   // Enemy and collectible positions
+    EnemyAI = 3,     // Wandering enemy moves
+    Player = 4       // Simulated player moves (batch runs)
+};
+
+/**
+ * Random class: a small, fast xoshiro256** generator
+ * Each owner keeps its own instance, so no state is shared between
+ * objects or threads and a given seed always replays the same sequence.
+ * Seeds are spread over the 256-bit state with splitmix64, so nearby
+ * seeds still give unrelated sequences.
+ */
+class Random {
+private:
+    uint64_t state[4];
+
+    static uint64_t rotateLeft(uint64_t value, int bits) { return (value << bits) | (value >> (64 - bits)); }
+
+public:
+    static const uint64_t DEFAULT_SEED = 0x853C49E6748FEA9BULL;
+
+    // Constructor
+    explicit Random(uint64_t seed = DEFAULT_SEED) { reseed(seed); }
+
+    // Seeding
+    void reseed(uint64_t seed);
+    static uint64_t deriveSeed(uint64_t seed, RandomStream stream, uint64_t index);
+    static uint64_t seedFromClock();
+
+    /**
+     * Next 64 random bits
+     * @return Uniformly distributed value
+     */
+    uint64_t next() {
+        const uint64_t result = rotateLeft(state[1] * 5, 7) * 9;
+        const uint64_t shifted = state[1] << 17;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= shifted;
+        state[3] = rotateLeft(state[3], 45);
+        return result;
+    }
+
+    /**
+     * Random integer below a bound, by multiply-shift instead of division
+     * The bias is below bound / 2^32, far too small to matter for a maze
+     * @param bound Exclusive upper bound (positive)
+     * @return Value in [0, bound)
+     */
+    int below(int bound) {
+        return static_cast<int>(((next() >> 32) * static_cast<uint64_t>(bound)) >> 32);
+    }
+};
+
+#endif // RANDOM_H
@@ -0,0 +1,129 @@
+#include "SaveFormat.h"
+#include <cstring>
+
+static const uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+static const uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+
+/**
+ * Round a byte count up to the next multiple of 8
+ * @param size Byte count
+ * @return Padded byte count
+ */
+static size_t alignToWord(size_t size) {
+    return (size + 7) & ~static_cast<size_t>(7);
+}
+
+/**
+ * Work out where each section of a save file lives
+ * @param width Maze width in cells
+ * @param height Maze height in cells
+ * @param enemyCount Number of enemies
+ * @param collectibleCount Number of collectibles
+ * @return Section offsets and the total file size
+ */
+SaveLayout SaveLayout::compute(int width, int height, uint32_t enemyCount, uint32_t collectibleCount) {
+    SaveLayout layout;
+    layout.gridOffset = sizeof(SaveHeader);
+    layout.enemyOffset = layout.gridOffset + alignToWord(static_cast<size_t>(width) * height);
+    layout.collectibleOffset = layout.enemyOffset + alignToWord(static_cast<size_t>(enemyCount) * 17);
+    layout.totalSize = layout.collectibleOffset + alignToWord(static_cast<size_t>(collectibleCount) * 13);
+    return layout;
+}
+
+/**
+ * Mix one word into a lane
+ * @param lane Lane state
+ * @param word Next 8 bytes of input
+ * @return New lane state
+ */
+static inline uint64_t mixWord(uint64_t lane, uint64_t word) {
+    lane += word * PRIME_2;
+    lane = (lane << 31) | (lane >> 33);
+    return lane * PRIME_1;
+}
+
+/**
+ * Rotate a 64-bit value left
+ * @param value Value to rotate
+ * @param bits Rotation in bits (1-63)
+ * @return Rotated value
+ */
+static inline uint64_t rotateLeft(uint64_t value, int bits) {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+/**
+ * Constructor for SaveChecksum class
+ */
+SaveChecksum::SaveChecksum() : wordCount(0) {
+    lanes[0] = PRIME_1 + PRIME_2;
+    lanes[1] = PRIME_2;
+    lanes[2] = 0;
+    lanes[3] = 0 - PRIME_1;
+}
+
+/**
+ * Add data to the hash
+ * @param data Bytes to hash
+ * @param size Byte count (a multiple of 8; any extra bytes are ignored)
+ */
+void SaveChecksum::update(const char* data, size_t size) {
+    size_t words = size / 8;
+    size_t i = 0;
+
+    // Bring the lane index back to 0 so the main loop can take whole stripes
+    for (; i < words && (wordCount & 3) != 0; i++, wordCount++) {
+        uint64_t word;
+        std::memcpy(&word, data + i * 8, 8);
+        lanes[wordCount & 3] = mixWord(lanes[wordCount & 3], word);
+    }
+
+    uint64_t lane0 = lanes[0], lane1 = lanes[1], lane2 = lanes[2], lane3 = lanes[3];
+    for (; i + 4 <= words; i += 4) {
+        uint64_t stripe[4];
+        std::memcpy(stripe, data + i * 8, 32);
+        lane0 = mixWord(lane0, stripe[0]);
+        lane1 = mixWord(lane1, stripe[1]);
+        lane2 = mixWord(lane2, stripe[2]);
+        lane3 = mixWord(lane3, stripe[3]);
+        wordCount += 4;
+    }
+    lanes[0] = lane0; lanes[1] = lane1; lanes[2] = lane2; lanes[3] = lane3;
+
+    for (; i < words; i++, wordCount++) {
+        uint64_t word;
+        std::memcpy(&word, data + i * 8, 8);
+        lanes[wordCount & 3] = mixWord(lanes[wordCount & 3], word);
+    }
+}
+
+/**
+ * Combine the lanes into the final hash
+ * @return 64-bit checksum of everything passed to update
+ */
+uint64_t SaveChecksum::finish() const {
+    uint64_t hash = rotateLeft(lanes[0], 1) + rotateLeft(lanes[1], 7) +
+                    rotateLeft(lanes[2], 12) + rotateLeft(lanes[3], 18);
+    hash += wordCount * 8;
+    hash ^= hash >> 33;
+    hash *= PRIME_2;
+    hash ^= hash >> 29;
+    hash *= PRIME_3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+/**
+ * Store the checksum in a complete save image
+ * @param image Save image whose header checksum field is still zero
+ * @param size Image size in bytes
+ */
+void sealSaveImage(char* image, size_t size) {
+    SaveHeader header;
+    std::memcpy(&header, image, sizeof(header));
+    SaveChecksum checksum;
+    checksum.update(image, size);
+    header.checksum = checksum.finish();
+    std::memcpy(image, &header, sizeof(header));
+}
@@ -0,0 +1,84 @@
+#ifndef SAVEFORMAT_H
+#define SAVEFORMAT_H
+
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Binary save file layout (format version 2)
+ *
+ *   SaveHeader                     fixed size, see below
+ *   grid                           width * height cell bytes, row-major
+ *   enemies                        x[], y[], moveTimer[], moveDelay[] (int32), active[] (uint8)
+ *   collectibles                   x[], y[], pointValue[] (int32), collected[] (uint8)
+ *
+ * Every section starts on an 8-byte boundary. Integers are stored in the
+ * machine's native byte order, so a file can be used straight from memory
+ * without parsing. The checksum covers the header (with the checksum field
+ * zeroed) and every section.
+ */
+
+/**
+ * Fixed header at the start of a binary save file
+ */
+struct SaveHeader {
+    char magic[8];              // SAVE_MAGIC
+    uint32_t version;           // SAVE_FORMAT_VERSION
+    uint32_t headerSize;        // sizeof(SaveHeader)
+    int32_t level;
+    int32_t score;
+    int32_t moves;
+    int32_t playerX, playerY;
+    int32_t width, height;      // Maze size in cells
+    int32_t exitX, exitY;
+    uint32_t flags;             // SAVE_FLAG_* bits
+    uint32_t enemyCount;
+    uint32_t collectibleCount;
+    uint64_t checksum;
+};
+
+static_assert(sizeof(SaveHeader) == 72, "SaveHeader is copied to and from disk as is");
+
+const char SAVE_MAGIC[8] = {'M', 'A', 'Z', 'E', 'S', 'A', 'V', '2'};
+const uint32_t SAVE_FORMAT_VERSION = 2;
+const uint32_t SAVE_FLAG_LEVEL_WON = 1;
+
+/**
+ * Byte offsets of each section of a binary save file
+ */
+struct SaveLayout {
+    size_t gridOffset;
+    size_t enemyOffset;
+    size_t collectibleOffset;
+    size_t totalSize;
+
+    static SaveLayout compute(int width, int height, uint32_t enemyCount, uint32_t collectibleCount);
+};
+
+/**
+ * SaveChecksum class hashing a save image in 8-byte words
+ * Four independent multiply-rotate lanes keep the hash running at memory
+ * speed. Data may be fed in several pieces, each a multiple of 8 bytes.
+ */
+class SaveChecksum {
+private:
+    uint64_t lanes[4];
+    uint64_t wordCount;
+
+public:
+    // Constructor
+    SaveChecksum();
+
+    // Hashing
+    void update(const char* data, size_t size);
+    uint64_t finish() const;
+};
+
+/**
+ * Store the checksum in a complete save image
+ * @param image Save image whose header checksum field is still zero
+ * @param size Image size in bytes
+ */
+void sealSaveImage(char* image, size_t size);
+
+#endif // SAVEFORMAT_H
@@ -0,0 +1,180 @@
+#include "SaveWriter.h"
+#include "SaveFormat.h"
+#include <cstdio>
+
+#ifdef _WIN32
+    #include <windows.h>
+    #include <io.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <cerrno>
+#endif
+
+/**
+ * Constructor for SaveWriter class
+ * No thread is started until there is something to save
+ */
+SaveWriter::SaveWriter() : busy(0), stopping(false) {
+}
+
+/**
+ * Destructor for SaveWriter class
+ * Blocks until queued saves are on disk, so quitting never loses one
+ */
+SaveWriter::~SaveWriter() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeWorker.notify_one();
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+/**
+ * Queue a save image for writing
+ * @param slot Slot number, reported back in the result
+ * @param filename Final name of the save file
+ * @param image Unsealed save image; its contents are taken and it is left empty
+ */
+void SaveWriter::submit(int slot, const std::string& filename, std::vector<char>& image) {
+    Job job;
+    job.slot = slot;
+    job.filename = filename;
+    job.image.swap(image);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+        busy++;
+        if (!worker.joinable()) {
+            worker = std::thread(&SaveWriter::workerLoop, this);
+        }
+    }
+    wakeWorker.notify_one();
+}
+
+/**
+ * Collect the result of a finished save without waiting
+ * @param result Receives the oldest uncollected result
+ * @return true if a result was available
+ */
+bool SaveWriter::pollResult(SaveResult& result) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (results.empty()) {
+        return false;
+    }
+    result = results.front();
+    results.pop_front();
+    return true;
+}
+
+/**
+ * Block until every queued save has been written
+ * Used before reading a slot back, so a load never sees an older file
+ */
+void SaveWriter::waitUntilIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    jobDone.wait(lock, [this]() { return busy == 0; });
+}
+
+/**
+ * Check whether saves are still queued or being written
+ * @return true while the worker has work left
+ */
+bool SaveWriter::isBusy() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return busy > 0;
+}
+
+/**
+ * Worker thread: seal and write queued images until shutdown
+ */
+void SaveWriter::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        wakeWorker.wait(lock, [this]() { return stopping || !jobs.empty(); });
+        if (jobs.empty()) {
+            return; // Stopping, and nothing left to write
+        }
+
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        lock.unlock();
+
+        sealSaveImage(job.image.data(), job.image.size());
+        SaveResult result;
+        result.slot = job.slot;
+        result.success = writeFileAtomically(job.filename, job.image);
+        std::vector<char>().swap(job.image); // Free the snapshot before taking the lock
+
+        lock.lock();
+        results.push_back(result);
+        busy--;
+        jobDone.notify_all();
+    }
+}
+
+/**
+ * Write a file so that it is either fully replaced or left untouched
+ * Writes to a temporary file, flushes it to disk, then renames it over
+ * the target (and on POSIX flushes the directory entry too)
+ * @param filename File to replace
+ * @param image Bytes to write
+ * @return true if the new contents are in place
+ */
+bool SaveWriter::writeFileAtomically(const std::string& filename, const std::vector<char>& image) {
+    const std::string temporary = filename + ".tmp";
+
+#ifdef _WIN32
+    FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (!file) {
+        return false;
+    }
+    bool written = std::fwrite(image.data(), 1, image.size(), file) == image.size() &&
+                   std::fflush(file) == 0 && _commit(_fileno(file)) == 0;
+    written = std::fclose(file) == 0 && written;
+    if (!written ||
+        !MoveFileExA(temporary.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+#else
+    int descriptor = open(temporary.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    size_t offset = 0;
+    while (offset < image.size()) {
+        ssize_t count = write(descriptor, image.data() + offset, image.size() - offset);
+        if (count < 0 && errno == EINTR) {
+            continue;
+        }
+        if (count <= 0) {
+            break;
+        }
+        offset += static_cast<size_t>(count);
+    }
+
+    bool written = offset == image.size() && fsync(descriptor) == 0;
+    written = close(descriptor) == 0 && written;
+    if (!written || std::rename(temporary.c_str(), filename.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    // Make the rename itself durable
+    const size_t slash = filename.find_last_of('/');
+    const std::string directory = slash == std::string::npos ? "." : filename.substr(0, slash + 1);
+    int directoryDescriptor = open(directory.c_str(), O_RDONLY);
+    if (directoryDescriptor >= 0) {
+        fsync(directoryDescriptor);
+        close(directoryDescriptor);
+    }
+    return true;
+#endif
+}
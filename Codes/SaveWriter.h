@@ -0,0 +1,67 @@
+#ifndef SAVEWRITER_H
+#define SAVEWRITER_H
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * Outcome of one background save
+ */
+struct SaveResult {
+    int slot;        // Slot the save was requested for
+    bool success;    // Whether the file was written and renamed into place
+};
+
+/**
+ * SaveWriter class writing save images to disk on a worker thread
+ * The game loop hands over a snapshot and carries on; the worker seals it
+ * with its checksum, writes it to a temporary file, flushes it to disk and
+ * renames it over the slot file, so a crash never leaves a partial save.
+ * Results are collected by the loop with pollResult.
+ */
+class SaveWriter {
+private:
+    /**
+     * One queued save
+     */
+    struct Job {
+        int slot;
+        std::string filename;
+        std::vector<char> image;
+    };
+
+    std::thread worker;                 // Started on the first submit
+    std::mutex mutex;                   // Guards everything below
+    std::condition_variable wakeWorker; // Signalled when a job is queued or on shutdown
+    std::condition_variable jobDone;    // Signalled whenever a job finishes
+    std::deque<Job> jobs;               // Saves waiting for the worker
+    std::deque<SaveResult> results;     // Finished saves not yet collected
+    int busy;                           // Jobs queued or being written
+    bool stopping;
+
+    void workerLoop();
+    static bool writeFileAtomically(const std::string& filename, const std::vector<char>& image);
+
+public:
+    // Constructor
+    SaveWriter();
+
+    // Destructor (finishes every queued save first)
+    ~SaveWriter();
+
+    // Not copyable: owns a thread
+    SaveWriter(const SaveWriter&) = delete;
+    SaveWriter& operator=(const SaveWriter&) = delete;
+
+    // Saving
+    void submit(int slot, const std::string& filename, std::vector<char>& image);
+    bool pollResult(SaveResult& result);
+    void waitUntilIdle();
+    bool isBusy();
+};
+
+#endif // SAVEWRITER_H
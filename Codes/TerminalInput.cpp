@@ -0,0 +1,229 @@
+#include "TerminalInput.h"
+
+#ifdef _WIN32
+    #include <conio.h>
+    #include <windows.h>
+#else
+    #include <termios.h>
+    #include <unistd.h>
+    #include <poll.h>
+    #include <signal.h>
+    #include <cerrno>
+    #include <cstdlib>
+#endif
+
+#ifndef _WIN32
+// Terminal settings to restore; file scope so the signal handler can reach them
+static struct termios savedTermios;
+static volatile sig_atomic_t savedTermiosValid = 0;
+
+/**
+ * Put the terminal back the way it was found
+ * Async-signal-safe: only calls tcsetattr
+ */
+static void restoreSavedTermios() {
+    if (savedTermiosValid) {
+        tcsetattr(STDIN_FILENO, TCSANOW, &savedTermios);
+        savedTermiosValid = 0;
+    }
+}
+
+/**
+ * Restore the terminal, then let the signal take its default action
+ * @param signalNumber Signal being handled
+ */
+static void handleFatalSignal(int signalNumber) {
+    restoreSavedTermios();
+    signal(signalNumber, SIG_DFL);
+    raise(signalNumber);
+}
+#endif
+
+/**
+ * Constructor for TerminalInput class
+ * The terminal is left untouched until enterRawMode is called
+ */
+TerminalInput::TerminalInput() : head(0), count(0), rawMode(false), endOfInput(false) {
+}
+
+/**
+ * Destructor for TerminalInput class
+ */
+TerminalInput::~TerminalInput() {
+    restore();
+}
+
+/**
+ * Switch the terminal to raw mode for the rest of the session
+ * Does nothing when standard input is not a terminal
+ */
+void TerminalInput::enterRawMode() {
+#ifndef _WIN32
+    if (rawMode || !isatty(STDIN_FILENO) || tcgetattr(STDIN_FILENO, &savedTermios) != 0) {
+        return;
+    }
+    savedTermiosValid = 1;
+
+    static bool handlersInstalled = false;
+    if (!handlersInstalled) {
+        std::atexit(restoreSavedTermios);
+        const int fatalSignals[] = {SIGINT, SIGTERM, SIGHUP, SIGQUIT};
+        for (int signalNumber : fatalSignals) {
+            signal(signalNumber, handleFatalSignal);
+        }
+        handlersInstalled = true;
+    }
+
+    struct termios raw = savedTermios;
+    raw.c_lflag &= ~(ICANON | ECHO);
+    raw.c_cc[VMIN] = 0;   // read never blocks; poll does the waiting
+    raw.c_cc[VTIME] = 0;
+    tcsetattr(STDIN_FILENO, TCSANOW, &raw);
+#endif
+    rawMode = true;
+}
+
+/**
+ * Restore the terminal settings saved by enterRawMode
+ */
+void TerminalInput::restore() {
+    if (!rawMode) {
+        return;
+    }
+#ifndef _WIN32
+    restoreSavedTermios();
+#endif
+    rawMode = false;
+}
+
+/**
+ * Wait until a key is available or the timeout expires
+ * Keys that are already queued count as available immediately
+ * @param timeoutMs Milliseconds to wait (0 = just check, negative = forever)
+ * @return true if at least one key is queued
+ */
+bool TerminalInput::waitForInput(int timeoutMs) {
+    if (count > 0) {
+        return true;
+    }
+
+#ifdef _WIN32
+    DWORD start = GetTickCount();
+    while (!_kbhit()) {
+        if (timeoutMs >= 0 && static_cast<int>(GetTickCount() - start) >= timeoutMs) {
+            return false;
+        }
+        Sleep(1);
+    }
+#else
+    if (endOfInput) {
+        // Nothing will ever arrive; just let the time pass
+        if (timeoutMs > 0) {
+            poll(nullptr, 0, timeoutMs);
+        }
+        return false;
+    }
+
+    struct pollfd descriptor;
+    descriptor.fd = STDIN_FILENO;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+
+    int ready = poll(&descriptor, 1, timeoutMs);
+    if (ready <= 0) {
+        return false; // Timeout, or interrupted by a signal
+    }
+#endif
+
+    drain();
+    return count > 0;
+}
+
+/**
+ * Move every byte currently pending on standard input into the queue
+ * Stops early (leaving bytes in the kernel buffer) if the queue is full
+ */
+void TerminalInput::drain() {
+#ifdef _WIN32
+    while (count < QUEUE_SIZE && _kbhit()) {
+        push(static_cast<char>(_getch()));
+    }
+#else
+    char buffer[QUEUE_SIZE];
+    while (count < QUEUE_SIZE) {
+        struct pollfd descriptor;
+        descriptor.fd = STDIN_FILENO;
+        descriptor.events = POLLIN;
+        descriptor.revents = 0;
+        if (poll(&descriptor, 1, 0) <= 0) {
+            break;
+        }
+
+        ssize_t bytesRead = read(STDIN_FILENO, buffer, QUEUE_SIZE - count);
+        if (bytesRead < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytesRead <= 0) {
+            endOfInput = bytesRead == 0;
+            break;
+        }
+        for (ssize_t i = 0; i < bytesRead; i++) {
+            push(buffer[i]);
+        }
+    }
+#endif
+}
+
+/**
+ * Append a key to the queue (caller checks there is room)
+ * @param key Key to queue
+ */
+void TerminalInput::push(char key) {
+    queue[(head + count) % QUEUE_SIZE] = key;
+    count++;
+}
+
+/**
+ * Take the oldest queued key without waiting
+ * @param key Receives the key
+ * @return true if a key was available
+ */
+bool TerminalInput::popKey(char& key) {
+    if (count == 0) {
+        drain();
+        if (count == 0) {
+            return false;
+        }
+    }
+    key = queue[head];
+    head = (head + 1) % QUEUE_SIZE;
+    count--;
+    return true;
+}
+
+/**
+ * Block until a key is available and return it
+ * @return Key pressed, or 0 if standard input was closed
+ */
+char TerminalInput::readKey() {
+    char key = 0;
+    while (!popKey(key)) {
+        if (endOfInput) {
+            return 0;
+        }
+        waitForInput(-1);
+    }
+    return key;
+}
+
+/**
+ * Get the descriptor input arrives on, for callers that poll it themselves
+ * @return File descriptor of standard input (-1 on Windows)
+ */
+int TerminalInput::getInputDescriptor() const {
+#ifdef _WIN32
+    return -1;
+#else
+    return STDIN_FILENO;
+#endif
+}
@@ -0,0 +1,42 @@
+#ifndef TERMINALINPUT_H
+#define TERMINALINPUT_H
+
+/**
+ * TerminalInput class owning keyboard input for a game session
+ * Puts the terminal into raw (non-canonical, no echo) mode once, restores
+ * it on exit or on a fatal signal, waits for input with poll and drains
+ * every pending byte into a key queue so fast typing is never dropped.
+ */
+class TerminalInput {
+private:
+    static const int QUEUE_SIZE = 256;
+
+    char queue[QUEUE_SIZE];  // Ring buffer of keys not yet consumed
+    int head, count;         // Index of the oldest key, number of queued keys
+    bool rawMode;            // Whether this object switched the terminal to raw mode
+    bool endOfInput;         // Standard input was closed
+
+    void push(char key);
+
+public:
+    // Constructor
+    TerminalInput();
+
+    // Destructor (restores the terminal)
+    ~TerminalInput();
+
+    // Terminal mode
+    void enterRawMode();
+    void restore();
+
+    // Input
+    bool waitForInput(int timeoutMs);
+    void drain();
+    bool popKey(char& key);
+    char readKey();
+    bool hasQueuedKeys() const { return count > 0; }
+    bool isEndOfInput() const { return endOfInput; }
+    int getInputDescriptor() const;
+};
+
+#endif // TERMINALINPUT_H
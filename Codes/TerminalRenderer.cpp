@@ -0,0 +1,282 @@
+#include "TerminalRenderer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+
+#ifdef _WIN32
+    #include <windows.h>
+#else
+    #include <unistd.h>
+    #include <cerrno>
+    #include <signal.h>
+    #include <sys/ioctl.h>
+#endif
+
+#ifndef _WIN32
+// Set by the SIGWINCH handler, cleared by takeResize; starts set so the first frame measures
+static volatile sig_atomic_t resizePending = 1;
+
+/**
+ * Note that the terminal changed size
+ * Async-signal-safe: only sets a flag
+ * @param signalNumber Signal being handled
+ */
+static void handleResizeSignal(int signalNumber) {
+    (void)signalNumber;
+    resizePending = 1;
+}
+#endif
+
+/**
+ * Constructor for TerminalRenderer class
+ * Nothing is known to be on screen yet, so the first frame is a full redraw
+ */
+TerminalRenderer::TerminalRenderer()
+    : previousWidth(0), previousHeight(0), screenValid(false), lastFrameFull(false), cursorHidden(false) {
+}
+
+/**
+ * Destructor for TerminalRenderer class
+ * Restores the cursor if the renderer hid it
+ */
+TerminalRenderer::~TerminalRenderer() {
+    if (cursorHidden) {
+        static const char showCursor[] = "\x1b[?25h";
+        writeToTerminal(showCursor, sizeof(showCursor) - 1);
+    }
+}
+
+/**
+ * Append an absolute cursor move (1-based row and column)
+ * @param row Terminal row
+ * @param column Terminal column
+ */
+void TerminalRenderer::appendCursorMove(int row, int column) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "\x1b[%d;%dH", row, column);
+    output.append(buffer, length);
+}
+
+/**
+ * Append a complete frame after clearing the screen
+ * @param cells Row-major display cells
+ * @param width Grid width in cells
+ * @param height Grid height in cells
+ * @param status Status lines shown below the grid
+ */
+void TerminalRenderer::appendFullFrame(const char* cells, int width, int height,
+                                       const std::vector<std::string>& status) {
+    output += "\x1b[?25l\x1b[H\x1b[2J";  // Hide cursor, home, clear screen
+
+    for (int i = 0; i < height; i++) {
+        const char* row = cells + i * width;
+        for (int j = 0; j < width; j++) {
+            output += row[j];
+            output += ' ';
+        }
+        output += "\r\n";
+    }
+
+    output += "\r\n";
+    for (const std::string& line : status) {
+        output += line;
+        output += "\r\n";
+    }
+}
+
+/**
+ * Append updates for grid cells that differ from the previous frame
+ * Neighbouring changed cells in a row share one cursor move
+ * @param cells Row-major display cells
+ * @param width Grid width in cells
+ * @param height Grid height in cells
+ */
+void TerminalRenderer::appendChangedCells(const char* cells, int width, int height) {
+    for (int i = 0; i < height; i++) {
+        const char* row = cells + i * width;
+        char* shown = &previousCells[i * width];
+        if (std::memcmp(row, shown, width) == 0) {
+            continue;
+        }
+
+        int j = 0;
+        while (j < width) {
+            if (row[j] == shown[j]) {
+                j++;
+                continue;
+            }
+
+            // Each cell is drawn as "c " starting at column 2 * j + 1
+            appendCursorMove(i + 1, 2 * j + 1);
+            while (j < width && row[j] != shown[j]) {
+                output += row[j];
+                output += ' ';
+                shown[j] = row[j];
+                j++;
+            }
+        }
+    }
+}
+
+/**
+ * Append updates for status lines that differ from the previous frame
+ * @param status Status lines shown below the grid
+ * @param firstRow Terminal row of the first status line
+ */
+void TerminalRenderer::appendChangedStatus(const std::vector<std::string>& status, int firstRow) {
+    const size_t lines = std::max(status.size(), previousStatus.size());
+    for (size_t i = 0; i < lines; i++) {
+        const bool hasNew = i < status.size();
+        const bool hasOld = i < previousStatus.size();
+        if (hasNew && hasOld && status[i] == previousStatus[i]) {
+            continue;
+        }
+
+        appendCursorMove(firstRow + static_cast<int>(i), 1);
+        if (hasNew) {
+            output += status[i];
+        }
+        output += "\x1b[K";  // Erase the rest of the old line
+    }
+}
+
+/**
+ * Build the escape sequences that turn the previous frame into this one
+ * Updates the remembered frame but does not write anything
+ * @param cells Row-major display cells
+ * @param width Grid width in cells
+ * @param height Grid height in cells
+ * @param status Status lines shown below the grid
+ * @return Bytes to send to the terminal (valid until the next call)
+ */
+const std::string& TerminalRenderer::buildFrame(const char* cells, int width, int height,
+                                                const std::vector<std::string>& status) {
+    output.clear();
+    lastFrameFull = !screenValid || width != previousWidth || height != previousHeight;
+
+    if (lastFrameFull) {
+        appendFullFrame(cells, width, height, status);
+        previousCells.assign(cells, cells + static_cast<size_t>(width) * height);
+        previousWidth = width;
+        previousHeight = height;
+        screenValid = true;
+    } else {
+        appendChangedCells(cells, width, height);
+        appendChangedStatus(status, height + 2);
+
+        // Park the cursor below the frame so other output starts on a clean line
+        appendCursorMove(height + 2 + static_cast<int>(status.size()), 1);
+    }
+
+    previousStatus = status;
+    return output;
+}
+
+/**
+ * Draw a frame on the terminal with a single write
+ * @param cells Row-major display cells
+ * @param width Grid width in cells
+ * @param height Grid height in cells
+ * @param status Status lines shown below the grid
+ */
+void TerminalRenderer::present(const char* cells, int width, int height,
+                               const std::vector<std::string>& status) {
+    // Anything still buffered in std::cout belongs before this frame
+    std::cout.flush();
+
+    const std::string& bytes = buildFrame(cells, width, height, status);
+    writeToTerminal(bytes.data(), bytes.size());
+    if (lastFrameFull) {
+        cursorHidden = true;
+    }
+}
+
+/**
+ * Write bytes to standard output, retrying on partial writes
+ * @param data Bytes to write
+ * @param length Number of bytes
+ */
+void TerminalRenderer::writeToTerminal(const char* data, size_t length) {
+#ifdef _WIN32
+    DWORD written = 0;
+    WriteFile(GetStdHandle(STD_OUTPUT_HANDLE), data, static_cast<DWORD>(length), &written, NULL);
+#else
+    while (length > 0) {
+        ssize_t written = write(STDOUT_FILENO, data, length);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return;
+        }
+        data += written;
+        length -= static_cast<size_t>(written);
+    }
+#endif
+}
+
+/**
+ * Get the size of the terminal standard output is connected to
+ * @param columns Receives the width in characters
+ * @param rows Receives the height in lines
+ * @return false if the size is unknown (output is not a terminal); the
+ *         arguments are then left unchanged
+ */
+bool TerminalRenderer::queryTerminalSize(int& columns, int& rows) {
+#ifdef _WIN32
+    CONSOLE_SCREEN_BUFFER_INFO info;
+    if (!GetConsoleScreenBufferInfo(GetStdHandle(STD_OUTPUT_HANDLE), &info)) {
+        return false;
+    }
+    columns = info.srWindow.Right - info.srWindow.Left + 1;
+    rows = info.srWindow.Bottom - info.srWindow.Top + 1;
+    return true;
+#else
+    struct winsize size;
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &size) != 0 || size.ws_col == 0 || size.ws_row == 0) {
+        return false;
+    }
+    columns = size.ws_col;
+    rows = size.ws_row;
+    return true;
+#endif
+}
+
+/**
+ * Start listening for terminal size changes
+ * Safe to call more than once
+ */
+void TerminalRenderer::watchResize() {
+#ifndef _WIN32
+    static bool handlerInstalled = false;
+    if (!handlerInstalled) {
+        signal(SIGWINCH, handleResizeSignal);
+        handlerInstalled = true;
+    }
+#endif
+}
+
+/**
+ * Check whether the terminal may have changed size since the last call
+ * Always true on the first call. Windows has no resize signal, so there
+ * the size is compared with the one seen last time.
+ * @return true if the caller should measure the terminal again
+ */
+bool TerminalRenderer::takeResize() {
+#ifdef _WIN32
+    static int lastColumns = -1, lastRows = -1;
+    int columns = 0, rows = 0;
+    queryTerminalSize(columns, rows);
+    const bool changed = columns != lastColumns || rows != lastRows;
+    lastColumns = columns;
+    lastRows = rows;
+    return changed;
+#else
+    if (!resizePending) {
+        return false;
+    }
+    resizePending = 0;
+    return true;
+#endif
+}
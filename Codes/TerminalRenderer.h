@@ -0,0 +1,55 @@
+#ifndef TERMINALRENDERER_H
+#define TERMINALRENDERER_H
+
+#include <vector>
+#include <string>
+
+/**
+ * TerminalRenderer class drawing game frames with ANSI escape sequences
+ * Remembers the last frame it emitted and, on the next frame, writes only
+ * cursor-positioned updates for the cells and status lines that changed.
+ * Each frame is sent with a single write, so the bytes per frame scale with
+ * the number of changed cells rather than with the size of the maze.
+ */
+class TerminalRenderer {
+private:
+    std::vector<char> previousCells;               // Cells shown on screen
+    std::vector<std::string> previousStatus;       // Status lines shown on screen
+    int previousWidth, previousHeight;             // Grid size shown on screen
+    bool screenValid;                              // false forces a full redraw
+    bool lastFrameFull;                            // Whether buildFrame redrew everything
+    bool cursorHidden;                             // Whether we hid the cursor
+    std::string output;                            // Escape sequences for one frame
+
+    void appendCursorMove(int row, int column);
+    void appendFullFrame(const char* cells, int width, int height,
+                         const std::vector<std::string>& status);
+    void appendChangedCells(const char* cells, int width, int height);
+    void appendChangedStatus(const std::vector<std::string>& status, int firstRow);
+
+public:
+    // Constructor
+    TerminalRenderer();
+
+    // Destructor (shows the cursor again if it was hidden)
+    ~TerminalRenderer();
+
+    // Frame output
+    const std::string& buildFrame(const char* cells, int width, int height,
+                                  const std::vector<std::string>& status);
+    void present(const char* cells, int width, int height,
+                 const std::vector<std::string>& status);
+
+    // Forget what is on screen (after menus or other output), forcing a full redraw
+    void invalidate() { screenValid = false; }
+
+    // Write raw bytes to the terminal in one call
+    static void writeToTerminal(const char* data, size_t length);
+
+    // Terminal size
+    static bool queryTerminalSize(int& columns, int& rows);
+    static void watchResize();
+    static bool takeResize();
+};
+
+#endif // TERMINALRENDERER_H
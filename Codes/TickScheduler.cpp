@@ -0,0 +1,83 @@
+#include "TickScheduler.h"
+
+/**
+ * Constructor for TickScheduler class
+ * @param ticksPerSecond Simulation rate
+ * @param maxCatchUpTicks Most ticks replayed at once after the loop falls behind
+ */
+TickScheduler::TickScheduler(double ticksPerSecond, int maxCatchUpTicks)
+    : tickInterval(), maxCatchUpTicks(1), nextTick(Clock::now()) {
+    setTickRate(ticksPerSecond);
+    setMaxCatchUpTicks(maxCatchUpTicks);
+}
+
+/**
+ * Change the simulation rate
+ * @param ticksPerSecond New rate (values below 1 are treated as 1)
+ */
+void TickScheduler::setTickRate(double ticksPerSecond) {
+    if (ticksPerSecond < 1.0) {
+        ticksPerSecond = 1.0;
+    }
+    tickInterval = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / ticksPerSecond));
+}
+
+/**
+ * Change how many missed ticks may be replayed back to back
+ * @param ticks New limit (at least 1)
+ */
+void TickScheduler::setMaxCatchUpTicks(int ticks) {
+    maxCatchUpTicks = ticks < 1 ? 1 : ticks;
+}
+
+/**
+ * Get the simulation rate
+ * @return Ticks per second
+ */
+double TickScheduler::getTickRate() const {
+    return 1.0 / std::chrono::duration<double>(tickInterval).count();
+}
+
+/**
+ * Start counting from now, forgetting any missed ticks
+ * Used when starting the loop and after blocking menus
+ */
+void TickScheduler::reset() {
+    nextTick = Clock::now() + tickInterval;
+}
+
+/**
+ * Collect the ticks whose deadlines have passed
+ * @return Number of ticks to run now (0 to maxCatchUpTicks)
+ */
+int TickScheduler::takeDueTicks() {
+    const Clock::time_point now = Clock::now();
+    int due = 0;
+    while (nextTick <= now && due < maxCatchUpTicks) {
+        nextTick += tickInterval;
+        due++;
+    }
+
+    // Too far behind: drop the backlog instead of fast-forwarding through it
+    if (nextTick <= now) {
+        nextTick = now + tickInterval;
+    }
+    return due;
+}
+
+/**
+ * Time left before the next tick falls due, for use as a wait timeout
+ * @return Milliseconds, rounded up (0 if a tick is already due)
+ */
+int TickScheduler::millisecondsUntilNextTick() const {
+    const Clock::duration remaining = nextTick - Clock::now();
+    if (remaining <= Clock::duration::zero()) {
+        return 0;
+    }
+    std::chrono::milliseconds whole = std::chrono::duration_cast<std::chrono::milliseconds>(remaining);
+    if (whole < remaining) {
+        ++whole; // Waking early would only cost another trip round the loop
+    }
+    return static_cast<int>(whole.count());
+}
@@ -0,0 +1,38 @@
+#ifndef TICKSCHEDULER_H
+#define TICKSCHEDULER_H
+
+#include <chrono>
+
+/**
+ * TickScheduler class pacing a fixed-timestep simulation
+ * Ticks fall due on deadlines measured from a monotonic clock, so time spent
+ * working or waiting for input does not stretch the tick period. When the
+ * loop falls behind, at most a limited number of missed ticks are replayed
+ * and the rest are dropped rather than run in a burst.
+ */
+class TickScheduler {
+public:
+    typedef std::chrono::steady_clock Clock;
+
+private:
+    Clock::duration tickInterval;   // Simulation time per tick
+    int maxCatchUpTicks;            // Most ticks run back to back after a stall
+    Clock::time_point nextTick;     // Deadline of the next tick
+
+public:
+    // Constructor
+    TickScheduler(double ticksPerSecond, int maxCatchUpTicks);
+
+    // Configuration
+    void setTickRate(double ticksPerSecond);
+    void setMaxCatchUpTicks(int ticks);
+    double getTickRate() const;
+    int getMaxCatchUpTicks() const { return maxCatchUpTicks; }
+
+    // Scheduling
+    void reset();
+    int takeDueTicks();
+    int millisecondsUntilNextTick() const;
+};
+
+#endif // TICKSCHEDULER_H
@@ -0,0 +1,105 @@
+#include "VectorEnv.h"
+#include <cstring>
+
+/**
+ * Constructor for VectorEnv class
+ * Every environment starts with a placeholder game; call reset before the
+ * first step
+ * @param count Number of environments
+ * @param mazeWidth Maze width for every environment (clamped like Maze::resize)
+ * @param mazeHeight Maze height for every environment (clamped like Maze::resize)
+ * @param algorithm Maze layout for every environment
+ * @param behavior Enemy behaviour for every environment
+ */
+VectorEnv::VectorEnv(int count, int mazeWidth, int mazeHeight, MazeAlgorithm algorithm, EnemyBehavior behavior)
+    : width(mazeWidth), height(mazeHeight) {
+    games.reserve(count > 0 ? count : 0);
+    for (int i = 0; i < count; i++) {
+        std::unique_ptr<Game> game(new Game(width, height, static_cast<uint64_t>(i)));
+        game->setEnemyBehavior(behavior);
+        game->setMazeAlgorithm(algorithm);
+        games.push_back(std::move(game));
+    }
+
+    // The maze clamps sizes it cannot hold, so observations use the size it settled on
+    if (!games.empty()) {
+        width = games[0]->getMaze().getWidth();
+        height = games[0]->getMaze().getHeight();
+    }
+
+    // Pad so every header starts aligned, whatever the grid size
+    const size_t align = alignof(EnvObservationHeader);
+    stride = (sizeof(EnvObservationHeader) + static_cast<size_t>(width) * height + align - 1) / align * align;
+}
+
+/**
+ * Start a new episode in every environment
+ * @param seeds One game seed per environment
+ * @param observations Buffer of getObservationBufferSize() bytes to fill
+ */
+void VectorEnv::reset(const uint64_t* seeds, char* observations) {
+    for (int i = 0; i < getCount(); i++) {
+        resetEnv(i, seeds[i], observations);
+    }
+}
+
+/**
+ * Start a new episode in one environment
+ * Lets a caller restart finished environments without touching the rest
+ * @param index Environment to reset
+ * @param seed Game seed for the new episode
+ * @param observations Buffer of getObservationBufferSize() bytes; only this
+ *                     environment's observation is written
+ */
+void VectorEnv::resetEnv(int index, uint64_t seed, char* observations) {
+    games[index]->newGame(seed);
+    writeObservation(index, observations);
+}
+
+/**
+ * Advance every environment by one tick
+ * Environments that are already done are left as they are
+ * @param actions One action per environment
+ * @param observations Buffer of getObservationBufferSize() bytes to fill
+ */
+void VectorEnv::step(const InputAction* actions, char* observations) {
+    for (int i = 0; i < getCount(); i++) {
+        if (!isDone(i)) {
+            games[i]->step(actions[i]);
+        }
+        writeObservation(i, observations);
+    }
+}
+
+/**
+ * Check whether an environment's episode is over
+ * @param index Environment to check
+ * @return true once the level is won, the player is caught, or the game quit
+ */
+bool VectorEnv::isDone(int index) const {
+    const Game& game = *games[index];
+    return !game.isGameRunning() || game.isGameOver() || game.isLevelWon();
+}
+
+/**
+ * Write one environment's header and grid into its slot of the buffer
+ * @param index Environment to write
+ * @param observations Start of the whole observation buffer
+ */
+void VectorEnv::writeObservation(int index, char* observations) const {
+    const Game& game = *games[index];
+    char* slot = observations + stride * index;
+
+    EnvObservationHeader header;
+    header.score = game.getPlayer().getScore();
+    header.moves = game.getPlayer().getMoveCount();
+    header.level = game.getCurrentLevel();
+    header.ticks = game.getTickCount();
+    header.done = isDone(index) ? 1 : 0;
+    header.won = game.isLevelWon() ? 1 : 0;
+    header.lost = game.isGameOver() ? 1 : 0;
+    header.reserved = 0;
+    std::memcpy(slot, &header, sizeof(header));
+
+    game.composeDisplay(slot + sizeof(header));
+}
@@ -0,0 +1,67 @@
+#ifndef VECTORENV_H
+#define VECTORENV_H
+
+#include "Game.h"
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * Fixed-size header at the start of each environment's observation
+ * Followed directly by the composed display grid, width * height characters
+ * row by row, the same characters Game::render draws.
+ */
+struct EnvObservationHeader {
+    int32_t score;
+    int32_t moves;
+    int32_t level;
+    uint32_t ticks;     // Steps since the last reset
+    uint8_t done;       // Episode over: level won, player caught, or quit
+    uint8_t won;
+    uint8_t lost;
+    uint8_t reserved;
+};
+
+/**
+ * VectorEnv class stepping many headless games in lockstep for automated players
+ * A gym-style interface over Game: reset and step take one seed or action
+ * per environment and write every observation into one contiguous buffer
+ * supplied by the caller, so a step builds no strings and allocates
+ * nothing. Environment i's observation starts at i * getObservationStride()
+ * bytes into the buffer. An episode is one level; once an environment is
+ * done its steps are ignored until it is reset.
+ */
+class VectorEnv {
+private:
+    std::vector<std::unique_ptr<Game>> games;
+    int width, height;             // Maze size shared by every environment
+    size_t stride;                 // Bytes per observation, header plus grid, padded
+
+    void writeObservation(int index, char* observations) const;
+
+public:
+    // Constructor
+    VectorEnv(int count, int mazeWidth, int mazeHeight,
+              MazeAlgorithm algorithm = MazeAlgorithm::ScatteredWalls,
+              EnemyBehavior behavior = EnemyBehavior::Wander);
+
+    // Destructor
+    ~VectorEnv() = default;
+
+    // Environment interface
+    void reset(const uint64_t* seeds, char* observations);
+    void resetEnv(int index, uint64_t seed, char* observations);
+    void step(const InputAction* actions, char* observations);
+    bool isDone(int index) const;
+
+    // Getters
+    int getCount() const { return static_cast<int>(games.size()); }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    size_t getObservationStride() const { return stride; }
+    size_t getObservationBufferSize() const { return stride * games.size(); }
+    const Game& getGame(int index) const { return *games[index]; }
+};
+
+#endif // VECTORENV_H
@@ -0,0 +1,919 @@
+/**
+ * Benchmark suite for the Maze Game
+ *
+ * Measures the hot paths of the game with fixed seeds across several maze
+ * sizes and entity counts:
+ * - Game::update, Game::checkCollisions and the headless Game::step
+ * - Game::update over the entity store at 10k, 100k and 1M entities,
+ *   wandering and chasing the player, and placing those entities
+ * - FlowField::build, the chase distance field, against maze size
+ * - Game::composeFrame (the camera window Game::render prints, built in memory)
+ * - Camera-windowed differential frames, which should cost the same at any maze size
+ * - TerminalRenderer::buildFrame, the differential update Game::render sends
+ * - Maze::generateLevel (including ensurePathExists) and Game::initializeLevel
+ * - Level transitions (nextLevel, resetGame), which reuse the entity arena
+ * - Perfect-maze generators (backtracker, Kruskal, Wilson) in cells per second
+ * - saveGameToSlot / loadGameFromSlot (binary saves, and legacy text saves)
+ *   and the snapshot a background save takes on the game loop
+ * - Maze::isExitReachable compared with a scalar breadth-first search
+ * - Headless replay of a recorded session (a synthetic 1M-tick recording,
+ *   plus any recordings passed with --log), checked against its outcome
+ * - Pathfinder shortest paths (BFS, A*, jump point search) and the minimal
+ *   wall repair ensurePathExists runs on unsolvable levels
+ * - ChunkedWorld streaming a disk-backed world as the player walks across it
+ * - VectorEnv::step over 10k environments writing into one observation buffer
+ * - BatchRunner playing thousands of games on 1, 2, 4... threads up to the
+ *   core count, with the speedup over one thread
+ *
+ * Results are written as JSON to stdout so runs can be compared over time.
+ * Every case also reports heap allocations per operation, counted by the
+ * replacement operator new below (the simulation tick should report 0).
+ *
+ * Usage: maze_benchmark [--quick] [--filter <substring>] [--min-time <seconds>] [--log <recording>]...
+ *
+ * Build (from this directory):
+ *   g++ -std=c++14 -O2 -pthread [-mavx2] benchmark.cpp Entity.cpp Player.cpp Maze.cpp EntityStore.cpp LevelArena.cpp OccupancyGrid.cpp TerminalRenderer.cpp TerminalInput.cpp TickScheduler.cpp MappedFile.cpp SaveFormat.cpp SaveWriter.cpp LevelPregenerator.cpp FlowField.cpp Pathfinder.cpp MazeGenerator.cpp Random.cpp InputLog.cpp Camera.cpp Game.cpp BatchRunner.cpp VectorEnv.cpp ChunkedWorld.cpp -o maze_benchmark
+ */
+
+#include "Game.h"
+#include "BatchRunner.h"
+#include "VectorEnv.h"
+#include "ChunkedWorld.h"
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <new>
+#include <atomic>
+#include <utility>
+#include <thread>
+
+// Heap allocations made by the whole process, counted for allocs_per_op
+static std::atomic<long long> allocationCount(0);
+
+// Keep the replacements out of line so GCC does not pair inlined malloc/free
+// with the standard new/delete and warn about a mismatch
+#if defined(__GNUC__)
+    #define BENCHMARK_NOINLINE __attribute__((noinline))
+#else
+    #define BENCHMARK_NOINLINE
+#endif
+
+BENCHMARK_NOINLINE void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+BENCHMARK_NOINLINE void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+BENCHMARK_NOINLINE void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+/**
+ * Stream buffer that discards everything written to it
+ * Used to silence console messages from the save/load paths
+ */
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return c; }
+};
+
+/**
+ * One measured benchmark case
+ */
+struct BenchmarkResult {
+    std::string name;
+    int mazeSize;
+    int entities;
+    long long iterations;
+    double nsPerOp;
+    double allocationsPerOp;
+    std::vector<std::pair<std::string, double>> metrics;  // Extra counters
+};
+
+/**
+ * Runs benchmark cases and collects their results
+ */
+class BenchmarkSuite {
+private:
+    std::vector<BenchmarkResult> results;
+    std::string filter;
+    double minSeconds;
+
+public:
+    BenchmarkSuite(const std::string& nameFilter, double minimumSeconds)
+        : filter(nameFilter), minSeconds(minimumSeconds) {}
+
+    /**
+     * Check whether a case passes the name filter
+     * @param name Case name
+     * @return true if the case should run
+     */
+    bool enabled(const std::string& name) const {
+        return filter.empty() || name.find(filter) != std::string::npos;
+    }
+
+    /**
+     * Time an operation, doubling the batch size until the minimum time is reached
+     * @param name Case name
+     * @param mazeSize Maze width and height
+     * @param entities Number of entities in the game
+     * @param op Operation to time (called once per iteration)
+     * @return Index of the recorded result, or -1 if the case was filtered out
+     */
+    template <typename Operation>
+    int run(const std::string& name, int mazeSize, int entities, Operation op) {
+        if (!enabled(name)) {
+            return -1;
+        }
+
+        op(); // Warm up caches and lazily sized buffers
+
+        long long iterations = 0;
+        long long batch = 1;
+        double totalNs = 0;
+        const long long allocationsBefore = allocationCount.load();
+        while (totalNs < minSeconds * 1e9) {
+            auto start = std::chrono::steady_clock::now();
+            for (long long i = 0; i < batch; i++) {
+                op();
+            }
+            auto end = std::chrono::steady_clock::now();
+            totalNs += std::chrono::duration<double, std::nano>(end - start).count();
+            iterations += batch;
+            batch *= 2;
+        }
+        const long long allocations = allocationCount.load() - allocationsBefore;
+
+        BenchmarkResult result;
+        result.name = name;
+        result.mazeSize = mazeSize;
+        result.entities = entities;
+        result.iterations = iterations;
+        result.nsPerOp = totalNs / iterations;
+        result.allocationsPerOp = static_cast<double>(allocations) / iterations;
+        results.push_back(result);
+
+        std::cerr << name << " size=" << mazeSize << " entities=" << entities
+                  << " " << result.nsPerOp << " ns/op" << std::endl;
+        return static_cast<int>(results.size()) - 1;
+    }
+
+    /**
+     * Attach an extra counter to a recorded result
+     * @param index Index returned by run (ignored if -1)
+     * @param key Metric name
+     * @param value Metric value
+     */
+    void addMetric(int index, const std::string& key, double value) {
+        if (index >= 0) {
+            results[index].metrics.push_back(std::make_pair(key, value));
+        }
+    }
+
+    /**
+     * Get the measured time of a recorded result
+     * @param index Index returned by run
+     * @return Nanoseconds per operation
+     */
+    double getNsPerOp(int index) const {
+        return results[index].nsPerOp;
+    }
+
+    /**
+     * Write all results as a JSON document
+     * @param out Stream to write to
+     */
+    void writeJson(std::ostream& out) const {
+        out << "{\n  \"suite\": \"maze_game\",\n  \"results\": [";
+        for (size_t i = 0; i < results.size(); i++) {
+            const BenchmarkResult& r = results[i];
+            char buffer[64];
+            std::snprintf(buffer, sizeof(buffer), "%.3f", r.nsPerOp);
+
+            out << (i ? "," : "") << "\n    {\"name\": \"" << r.name << "\""
+                << ", \"maze_size\": " << r.mazeSize
+                << ", \"entities\": " << r.entities
+                << ", \"iterations\": " << r.iterations
+                << ", \"ns_per_op\": " << buffer;
+            std::snprintf(buffer, sizeof(buffer), "%.6g", r.allocationsPerOp);
+            out << ", \"allocs_per_op\": " << buffer;
+            for (const auto& metric : r.metrics) {
+                std::snprintf(buffer, sizeof(buffer), "%.6g", metric.second);
+                out << ", \"" << metric.first << "\": " << buffer;
+            }
+            out << "}";
+        }
+        out << "\n  ]\n}" << std::endl;
+    }
+};
+
+/**
+ * Create a game with a fixed seed and a given number of entities
+ * @param size Maze width and height
+ * @param entities Total entities, split evenly between enemies and collectibles
+ * @param seed Random seed
+ * @return Freshly initialized game
+ */
+static std::unique_ptr<Game> makeGame(int size, int entities, uint64_t seed) {
+    std::unique_ptr<Game> game(new Game(size, size, seed));
+    game->spawnEntities(entities / 2, entities - entities / 2);
+    return game;
+}
+
+/**
+ * Reference reachability check: scalar BFS over Maze::getCell
+ * @param maze Maze to search
+ * @param toX Target X coordinate
+ * @param toY Target Y coordinate
+ * @return true if the target can be reached from (1,1)
+ */
+static bool scalarBfsReachable(const Maze& maze, int toX, int toY) {
+    const int width = maze.getWidth();
+    const int height = maze.getHeight();
+    std::vector<char> visited(static_cast<size_t>(width) * height, 0);
+    std::vector<int> queue;
+    queue.reserve(visited.size());
+
+    if (maze.getCell(1, 1) == '#') {
+        return false;
+    }
+    queue.push_back(width + 1);
+    visited[width + 1] = 1;
+
+    const int dx[] = {0, 1, 0, -1};
+    const int dy[] = {-1, 0, 1, 0};
+    for (size_t head = 0; head < queue.size(); head++) {
+        int x = queue[head] % width;
+        int y = queue[head] / width;
+        if (x == toX && y == toY) {
+            return true;
+        }
+        for (int d = 0; d < 4; d++) {
+            int nx = x + dx[d];
+            int ny = y + dy[d];
+            if (maze.getCell(nx, ny) != '#' && !visited[ny * width + nx]) {
+                visited[ny * width + nx] = 1;
+                queue.push_back(ny * width + nx);
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Tick, collision and headless step benchmarks
+ */
+static void benchmarkSimulation(BenchmarkSuite& suite, const std::vector<int>& sizes,
+                                const std::vector<int>& entityCounts) {
+    for (int size : sizes) {
+        for (int entities : entityCounts) {
+            if (entities > size * size / 4) {
+                continue;
+            }
+
+            std::unique_ptr<Game> game = makeGame(size, entities, 1001);
+            suite.run("game_update", size, entities, [&]() { game->update(); });
+
+            game = makeGame(size, entities, 1002);
+            suite.run("game_check_collisions", size, entities, [&]() { game->checkCollisions(); });
+        }
+
+        // Random walk through the headless API, restarting whenever a game ends
+        std::unique_ptr<Game> game = makeGame(size, 0, 1003);
+        game->initializeLevel(1);
+        const InputAction moves[] = {InputAction::MoveUp, InputAction::MoveDown,
+                                     InputAction::MoveLeft, InputAction::MoveRight};
+        unsigned int walk = 1;
+        suite.run("game_step", size, 0, [&]() {
+            walk = walk * 1103515245u + 12345u;
+            InputAction action = game->isLevelWon() ? InputAction::NextLevel : moves[(walk >> 16) & 3];
+            if (!game->step(action)) {
+                game->step(InputAction::Restart);
+            }
+        });
+    }
+}
+
+/**
+ * Entity store scaling: one tick over very large entity populations
+ */
+static void benchmarkEntityScale(BenchmarkSuite& suite, int size, const std::vector<int>& entityCounts) {
+    for (int entities : entityCounts) {
+        std::unique_ptr<Game> game = makeGame(size, entities, 1501);
+        int result = suite.run("entity_store_update", size, entities, [&]() { game->update(); });
+        if (result >= 0) {
+            suite.addMetric(result, "ns_per_entity", suite.getNsPerOp(result) / entities);
+        }
+
+        // Same tick with every enemy chasing the (stationary) player
+        game = makeGame(size, entities, 1502);
+        game->setEnemyBehavior(EnemyBehavior::Chase);
+        result = suite.run("entity_store_update_chase", size, entities, [&]() { game->update(); });
+        if (result >= 0) {
+            suite.addMetric(result, "ns_per_entity", suite.getNsPerOp(result) / entities);
+        }
+
+        // Placing the whole population again, drawn from the free-cell index
+        result = suite.run("game_spawn_entities", size, entities, [&]() {
+            game->spawnEntities(entities / 2, entities - entities / 2);
+        });
+        if (result >= 0) {
+            suite.addMetric(result, "ns_per_entity", suite.getNsPerOp(result) / entities);
+            suite.addMetric(result, "free_cells_left", game->getOccupancy().getFreeCellCount());
+        }
+    }
+}
+
+/**
+ * Chase distance field rebuild (what each player move costs chasing enemies)
+ */
+static void benchmarkFlowField(BenchmarkSuite& suite, const std::vector<int>& sizes) {
+    for (int size : sizes) {
+        Maze maze(size, size);
+        maze.reseed(6001);
+        maze.generateLevel(3);
+        FlowField field;
+        const MazeView view = maze.view();
+        int result = suite.run("flow_field_build", size, 0, [&]() { field.build(view, 1, 1); });
+        if (result >= 0) {
+            suite.addMetric(result, "ns_per_cell", suite.getNsPerOp(result) / (static_cast<double>(size) * size));
+        }
+    }
+}
+
+/**
+ * Frame composition benchmarks (render into a memory sink)
+ */
+static void benchmarkRender(BenchmarkSuite& suite, const std::vector<int>& sizes) {
+    for (int size : sizes) {
+        int entities = std::max(8, size * size / 64);
+        std::unique_ptr<Game> game = makeGame(size, entities, 2001);
+        std::string sink;
+        int result = suite.run("game_render", size, entities, [&]() {
+            game->composeFrame(sink);
+        });
+        suite.addMetric(result, "bytes_per_frame", static_cast<double>(sink.size()));
+    }
+}
+
+/**
+ * Differential renderer: bytes and time per frame while the game runs
+ * Each operation steps the game once and builds the terminal update
+ */
+static void benchmarkTerminalRenderer(BenchmarkSuite& suite, const std::vector<int>& sizes) {
+    for (int size : sizes) {
+        int entities = std::max(8, size * size / 64);
+        std::unique_ptr<Game> game = makeGame(size, entities, 2101);
+        TerminalRenderer renderer;
+        std::vector<char> grid;
+        std::vector<std::string> status;
+        long long frames = 0, bytes = 0;
+        size_t fullFrameBytes = 0;
+
+        int result = suite.run("terminal_render_diff", size, entities, [&]() {
+            game->update();
+            game->composeDisplay(grid);
+            game->composeStatus(status);
+            const std::string& update = renderer.buildFrame(grid.data(), size, size, status);
+            if (frames == 0) {
+                fullFrameBytes = update.size();
+            }
+            frames++;
+            bytes += static_cast<long long>(update.size());
+        });
+        suite.addMetric(result, "full_frame_bytes", static_cast<double>(fullFrameBytes));
+        suite.addMetric(result, "bytes_per_frame", frames ? static_cast<double>(bytes) / frames : 0);
+    }
+}
+
+/**
+ * Camera-windowed rendering: compose and diff only the visible window while
+ * the camera scrolls, which should cost the same at every maze size
+ */
+static void benchmarkViewport(BenchmarkSuite& suite, const std::vector<int>& sizes) {
+    for (int size : sizes) {
+        int entities = std::max(8, size * size / 64);
+        std::unique_ptr<Game> game = makeGame(size, entities, 2201);
+        TerminalRenderer renderer;
+        Camera camera(40, 18);
+        std::vector<char> grid;
+        std::vector<std::string> status;
+        long long frames = 0, bytes = 0;
+
+        // The camera target sweeps along the middle row, so the window scrolls
+        // every few frames (the simulation is left out to time rendering alone)
+        int result = suite.run("terminal_render_viewport", size, entities, [&]() {
+            camera.follow(static_cast<int>(frames % size), size / 2, size, size);
+            grid.resize(static_cast<size_t>(camera.getWidth()) * camera.getHeight());
+            game->composeWindow(grid.data(), camera.getLeft(), camera.getTop(), camera.getWidth(), camera.getHeight());
+            game->composeStatus(status);
+            bytes += static_cast<long long>(renderer.buildFrame(grid.data(), camera.getWidth(), camera.getHeight(), status).size());
+            frames++;
+        });
+        suite.addMetric(result, "viewport_cells", camera.getWidth() * camera.getHeight());
+        suite.addMetric(result, "bytes_per_frame", frames ? static_cast<double>(bytes) / frames : 0);
+    }
+}
+
+/**
+ * Level generation and level initialization benchmarks
+ */
+static void benchmarkGeneration(BenchmarkSuite& suite, const std::vector<int>& sizes) {
+    for (int size : sizes) {
+        Maze maze(size, size);
+        maze.reseed(3001);
+        int level = 2;
+        long long generated = 0, repairedWalls = 0;
+        int result = suite.run("maze_generate_level", size, 0, [&]() {
+            maze.generateLevel(level);
+            level = level % 5 + 1;
+            generated++;
+            repairedWalls += maze.getRepairedWallCount();
+        });
+        suite.addMetric(result, "repaired_walls", generated ? static_cast<double>(repairedWalls) / generated : 0);
+        suite.addMetric(result, "path_length", maze.getExitPathLength());
+
+        std::unique_ptr<Game> game = makeGame(size, 0, 3002);
+        level = 1;
+        suite.run("game_initialize_level", size, 0, [&]() {
+            game->initializeLevel(level);
+            level = level % 5 + 1;
+        });
+
+        // The first pass through the levels sizes the entity arena; after
+        // that a transition should not touch the heap at all
+        std::unique_ptr<Game> fresh = makeGame(size, 0, 3003);
+        const long long allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+        for (int next = 2; next <= 5; next++) {
+            fresh->nextLevel();
+        }
+        const double firstPassAllocations =
+            (allocationCount.load(std::memory_order_relaxed) - allocationsBefore) / 4.0;
+        result = suite.run("game_level_transition", size, 0, [&]() {
+            if (fresh->getCurrentLevel() >= 5) {
+                fresh->resetGame();
+            } else {
+                fresh->nextLevel();
+            }
+        });
+        const LevelArena& arena = fresh->getEntities().getArena();
+        suite.addMetric(result, "first_pass_allocs_per_transition", firstPassAllocations);
+        suite.addMetric(result, "arena_bytes", static_cast<double>(arena.getCapacity()));
+        suite.addMetric(result, "arena_system_allocs", static_cast<double>(arena.getSystemAllocations()));
+    }
+}
+
+/**
+ * Perfect-maze generation throughput for each algorithm
+ */
+static void benchmarkMazeAlgorithms(BenchmarkSuite& suite, const std::vector<int>& sizes) {
+    static const MazeAlgorithm algorithms[3] = {
+        MazeAlgorithm::RecursiveBacktracker, MazeAlgorithm::Kruskal, MazeAlgorithm::Wilson
+    };
+    static const char* const names[3] = {
+        "maze_generate_backtracker", "maze_generate_kruskal", "maze_generate_wilson"
+    };
+
+    for (int size : sizes) {
+        for (int a = 0; a < 3; a++) {
+            Maze maze(size, size);
+            maze.reseed(3101);
+            int result = suite.run(names[a], size, 0, [&]() { maze.generateLevel(1, algorithms[a]); });
+            if (result >= 0) {
+                const double cells = static_cast<double>(size) * size;
+                suite.addMetric(result, "cells_per_second", cells / (suite.getNsPerOp(result) * 1e-9));
+                suite.addMetric(result, "path_length", maze.getExitPathLength());
+            }
+        }
+    }
+}
+
+/**
+ * Write a game's state as a legacy MAZEGAME_SAVE_V1 text save
+ * @param game Game to save
+ * @param filename Output file
+ */
+static void writeTextSave(const Game& game, const std::string& filename) {
+    const Maze& maze = game.getMaze();
+    std::ofstream file(filename);
+    file << "MAZEGAME_SAVE_V1\n" << game.getCurrentLevel() << "\n"
+         << game.getPlayer().getScore() << "\n" << game.getPlayer().getMoveCount() << "\n"
+         << game.getPlayer().getX() << " " << game.getPlayer().getY() << "\n";
+    for (int y = 0; y < maze.getHeight(); y++) {
+        file.write(maze.getCells() + static_cast<size_t>(y) * maze.getWidth(), maze.getWidth());
+        file << '\n';
+    }
+    int exitX, exitY;
+    maze.getExitPosition(exitX, exitY);
+    file << exitX << " " << exitY << "\n";
+}
+
+/**
+ * Save and load benchmarks (console messages are discarded)
+ * Loads also report milliseconds per megabyte of save file
+ */
+static void benchmarkSaveLoad(BenchmarkSuite& suite, const std::vector<int>& sizes) {
+    const int slot = 99;  // Outside the 1-5 range offered by the menus
+    const std::string filename = "maze_save_99.txt";
+    NullBuffer nullBuffer;
+    std::streambuf* console = std::cout.rdbuf(&nullBuffer);
+
+    for (int size : sizes) {
+        std::unique_ptr<Game> game = makeGame(size, 16, 4001);
+        suite.run("game_save_slot", size, 16, [&]() { game->saveGameToSlot(slot); });
+
+        // What a background save costs the game loop: the snapshot only
+        std::vector<char> snapshot;
+        suite.run("game_save_snapshot", size, 16, [&]() { game->snapshotSaveImage(snapshot); });
+
+        std::vector<char> image;
+        game->buildSaveImage(image);
+        const double megabytes = image.size() / (1024.0 * 1024.0);
+        int load = suite.run("game_load_slot", size, 16, [&]() { game->loadGameFromSlot(slot); });
+        if (load >= 0) {
+            suite.addMetric(load, "file_bytes", static_cast<double>(image.size()));
+            suite.addMetric(load, "ms_per_mb", suite.getNsPerOp(load) / 1e6 / megabytes);
+        }
+
+        writeTextSave(*game, filename);
+        int loadText = suite.run("game_load_slot_text_v1", size, 16, [&]() { game->loadGameFromSlot(slot); });
+        if (loadText >= 0) {
+            suite.addMetric(loadText, "ms_per_mb", suite.getNsPerOp(loadText) / 1e6 / megabytes);
+        }
+    }
+
+    std::cout.rdbuf(console);
+    std::remove(filename.c_str());
+}
+
+/**
+ * Exit reachability: word-parallel flood fill against a scalar BFS
+ */
+static void benchmarkReachability(BenchmarkSuite& suite, int size) {
+    Maze maze(size, size);
+    maze.reseed(5001);
+    maze.generateLevel(3);
+    maze.addWalls(size * size / 20);  // Extra walls, so the search has to work around them
+    int exitX, exitY;
+    maze.getExitPosition(exitX, exitY);
+
+    bool floodResult = false, bfsResult = false;
+    int flood = suite.run("maze_reachability_flood_fill", size, 0, [&]() {
+        floodResult = maze.isExitReachable();
+    });
+    int bfs = suite.run("maze_reachability_scalar_bfs", size, 0, [&]() {
+        bfsResult = scalarBfsReachable(maze, exitX, exitY);
+    });
+    suite.addMetric(flood, "reachable", floodResult ? 1.0 : 0.0);
+    suite.addMetric(bfs, "reachable", bfsResult ? 1.0 : 0.0);
+}
+
+/**
+ * Shortest path from the start to the exit with each search strategy,
+ * and the minimal repair of a maze whose exit is walled off
+ */
+static void benchmarkPathfinding(BenchmarkSuite& suite, const std::vector<int>& sizes) {
+    static const PathAlgorithm algorithms[3] = {
+        PathAlgorithm::BreadthFirst, PathAlgorithm::AStar, PathAlgorithm::JumpPoint
+    };
+    static const char* const names[3] = {"pathfind_bfs", "pathfind_astar", "pathfind_jps"};
+
+    for (int size : sizes) {
+        Maze maze(size, size);
+        maze.reseed(7001);
+        maze.generateLevel(3);
+        int exitX, exitY;
+        maze.getExitPosition(exitX, exitY);
+        const MazeView view = maze.view();
+        Pathfinder pathfinder;
+
+        for (int a = 0; a < 3; a++) {
+            int length = Pathfinder::NO_PATH;
+            int result = suite.run(names[a], size, 0, [&]() {
+                length = pathfinder.findPath(view, 1, 1, exitX, exitY, algorithms[a]);
+            });
+            suite.addMetric(result, "path_length", length);
+            suite.addMetric(result, "expanded", pathfinder.getExpandedCount());
+        }
+
+        // Wall off the exit so the repair has something to do
+        Maze blocked = maze;
+        blocked.setCell(exitX - 1, exitY, '#');
+        blocked.setCell(exitX, exitY - 1, '#');
+        int walls = Pathfinder::NO_PATH;
+        int result = suite.run("maze_minimal_repair", size, 0, [&]() {
+            walls = pathfinder.findMinimalRepair(blocked.view(), 1, 1, exitX, exitY);
+        });
+        suite.addMetric(result, "repaired_walls", walls);
+    }
+}
+
+/**
+ * Record a long headless session with random moves for the replay benchmark
+ * Restarts after a game over and advances after a won level, so the whole
+ * session is played rather than idling on a finished game
+ * @param size Maze width and height
+ * @param ticks Session length in simulation ticks
+ * @param log Receives the recording
+ */
+static void recordSyntheticSession(int size, int ticks, InputLog& log) {
+    Game game(size, size, 8001);
+    Random moves(8002);
+    game.startRecording();
+    for (int tick = 0; tick < ticks; tick++) {
+        InputAction action = InputAction::None;
+        if (game.isLevelWon()) {
+            action = game.getCurrentLevel() < 5 ? InputAction::NextLevel : InputAction::Restart;
+        } else if (game.isGameOver()) {
+            action = InputAction::Restart;
+        } else if (moves.below(4) == 0) {
+            action = static_cast<InputAction>(static_cast<int>(InputAction::MoveUp) + moves.below(4));
+        }
+        game.step(action);
+    }
+    game.finishRecording(log);
+}
+
+/**
+ * Time one headless replay and check that it reproduces the recording
+ * @param suite Suite to record the result in
+ * @param name Case name
+ * @param log Recording to replay
+ */
+static void benchmarkReplayLog(BenchmarkSuite& suite, const std::string& name, const InputLog& log) {
+    ReplayOutcome outcome;
+    bool matches = false;
+    int result = suite.run(name, log.getWidth(), 0, [&]() { matches = Game::replayLog(log, outcome); });
+    if (result >= 0) {
+        const double ticks = log.getOutcome().ticks;
+        suite.addMetric(result, "ticks", ticks);
+        suite.addMetric(result, "events", log.getEventCount());
+        suite.addMetric(result, "log_bytes", static_cast<double>(log.getEventBytes()));
+        suite.addMetric(result, "ns_per_tick", ticks > 0 ? suite.getNsPerOp(result) / ticks : 0);
+        suite.addMetric(result, "matches", matches ? 1.0 : 0.0);
+    }
+}
+
+/**
+ * Replay benchmarks: a synthetic session, then every recording given on the command line
+ */
+static void benchmarkReplay(BenchmarkSuite& suite, int ticks, const std::vector<std::string>& logFiles) {
+    if (suite.enabled("replay_synthetic")) {
+        InputLog log;
+        recordSyntheticSession(Maze::getDefaultSize(), ticks, log);
+        benchmarkReplayLog(suite, "replay_synthetic", log);
+    }
+    for (const std::string& filename : logFiles) {
+        InputLog log;
+        if (log.loadFromFile(filename)) {
+            benchmarkReplayLog(suite, "replay_recorded_log", log);
+        }
+    }
+}
+
+/**
+ * Batch simulation throughput against thread count
+ * Every run plays the same games, so the speedup is directly comparable
+ * @param suite Suite to record the results in
+ * @param size Maze width and height
+ * @param gameCount Games per batch
+ */
+static void benchmarkBatch(BenchmarkSuite& suite, int size, int gameCount) {
+    if (!suite.enabled("batch_run")) {
+        return;
+    }
+
+    std::vector<BatchJob> jobs(gameCount);
+    for (int i = 0; i < gameCount; i++) {
+        BatchJob& job = jobs[i];
+        job.seed = 1000 + i / 5;
+        job.level = 1 + i % 5;
+        job.width = size;
+        job.height = size;
+        job.algorithm = MazeAlgorithm::ScatteredWalls;
+        job.behavior = EnemyBehavior::Chase;
+        job.maxTicks = 4 * size * size;
+    }
+
+    const int cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    std::vector<int> threadCounts;
+    for (int threads = 1; threads < cores; threads *= 2) {
+        threadCounts.push_back(threads);
+    }
+    threadCounts.push_back(cores);
+
+    double singleThreadNs = 0;
+    for (int threads : threadCounts) {
+        BatchRunner runner(threads);
+        std::vector<BatchResult> results;
+        int result = suite.run("batch_run", size, gameCount, [&]() { runner.run(jobs, results); });
+        if (result < 0) {
+            continue;
+        }
+
+        uint64_t ticks = 0;
+        for (const BatchResult& r : results) {
+            ticks += r.ticks;
+        }
+        const double seconds = suite.getNsPerOp(result) / 1e9;
+        if (threads == 1) {
+            singleThreadNs = suite.getNsPerOp(result);
+        }
+        suite.addMetric(result, "threads", threads);
+        suite.addMetric(result, "games_per_second", gameCount / seconds);
+        suite.addMetric(result, "ticks_per_second", ticks / seconds);
+        suite.addMetric(result, "speedup", singleThreadNs / suite.getNsPerOp(result));
+    }
+}
+
+/**
+ * Disk-backed world: one player step (streaming update plus the four
+ * neighbour reads a move check makes) while walking rows across the world
+ * @param suite Suite to record the results in
+ * @param size World width and height
+ */
+static void benchmarkChunkedWorld(BenchmarkSuite& suite, int size) {
+    if (!suite.enabled("chunked_world")) {
+        return;
+    }
+
+    const std::string filename = "benchmark_world.maze";
+    NullBuffer nullBuffer;
+    std::streambuf* console = std::cout.rdbuf(&nullBuffer);
+    const bool created = ChunkedWorld::generateFile(filename, size, size, 1, 5001);
+    std::cout.rdbuf(console);
+    if (!created) {
+        return;
+    }
+
+    ChunkedWorld world;
+    EntityStore entities;
+    if (world.open(filename)) {
+        world.attachEntities(&entities);
+        Random random(5002);
+        for (int i = 0; i < size * size / 256; i++) {
+            world.addEnemy(random.below(size), random.below(size), 4);
+        }
+
+        // Walk along every eighth row, turning at the ends
+        int x = 1, y = 1, direction = 1;
+        int walls = 0;
+        const uint64_t loadsBefore = world.getChunkLoads();
+        long long steps = 0;
+        int result = suite.run("chunked_world_walk", size, size * size / 256, [&]() {
+            x += direction;
+            if (x <= 0 || x >= size - 1) {
+                direction = -direction;
+                x += 2 * direction;
+                y = y + 8 < size - 1 ? y + 8 : 1;
+            }
+            world.update(x, y, direction, 0);
+            walls += world.isWall(x + 1, y) + world.isWall(x - 1, y) + world.isWall(x, y + 1) + world.isWall(x, y - 1);
+            steps++;
+        });
+        if (result >= 0) {
+            suite.addMetric(result, "chunk_loads_per_1k_steps", 1000.0 * (world.getChunkLoads() - loadsBefore) / steps);
+            suite.addMetric(result, "cache_chunks", world.getCacheChunks());
+            suite.addMetric(result, "live_enemies", entities.getEnemyCount());
+            suite.addMetric(result, "wall_fraction", walls / (4.0 * steps));
+        }
+    }
+    world.close();
+    std::remove(filename.c_str());
+}
+
+/**
+ * Vectorized environment step across many environments
+ * Uses random moves; environments that finish stay done, so the done
+ * fraction is reported alongside the timing
+ * @param suite Suite to record the result in
+ * @param size Maze width and height
+ * @param count Number of environments
+ */
+static void benchmarkVectorEnv(BenchmarkSuite& suite, int size, int count) {
+    if (!suite.enabled("env_step")) {
+        return;
+    }
+
+    VectorEnv env(count, size, size);
+    std::vector<char> observations(env.getObservationBufferSize());
+    std::vector<uint64_t> seeds(count);
+    for (int i = 0; i < count; i++) {
+        seeds[i] = 3000 + i;
+    }
+    env.reset(seeds.data(), observations.data());
+
+    // A fixed table of random moves, cycled so the step itself does all the work
+    const int actionRows = 64;
+    std::vector<InputAction> actions(static_cast<size_t>(count) * actionRows);
+    Random random(17);
+    for (InputAction& action : actions) {
+        action = static_cast<InputAction>(static_cast<int>(InputAction::MoveUp) + random.below(4));
+    }
+
+    int row = 0;
+    int result = suite.run("env_step", size, count, [&]() {
+        env.step(&actions[static_cast<size_t>(row) * count], observations.data());
+        row = (row + 1) % actionRows;
+    });
+    if (result >= 0) {
+        int done = 0;
+        for (int i = 0; i < count; i++) {
+            done += env.isDone(i) ? 1 : 0;
+        }
+        suite.addMetric(result, "env_steps_per_second", count / (suite.getNsPerOp(result) / 1e9));
+        suite.addMetric(result, "observation_bytes", static_cast<double>(env.getObservationBufferSize()));
+        suite.addMetric(result, "done_fraction", static_cast<double>(done) / count);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bool quick = false;
+    std::string filter;
+    double minSeconds = 0.2;
+    std::vector<std::string> logFiles;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            quick = true;
+        } else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            minSeconds = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--log") == 0 && i + 1 < argc) {
+            logFiles.push_back(argv[++i]);
+        } else {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--quick] [--filter <substring>] [--min-time <seconds>] [--log <recording>]..."
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<int> sizes = {10, 64, 256, 1024};
+    std::vector<int> entityCounts = {8, 64, 512, 4096, 200000};
+    if (quick) {
+        sizes = {10, 64};
+        entityCounts = {8, 64};
+        minSeconds = std::min(minSeconds, 0.05);
+    }
+
+    BenchmarkSuite suite(filter, minSeconds);
+    benchmarkSimulation(suite, sizes, entityCounts);
+    if (quick) {
+        benchmarkEntityScale(suite, 256, {10000});
+    } else {
+        benchmarkEntityScale(suite, 2048, {10000, 100000, 1000000});
+    }
+    std::vector<int> fieldSizes = sizes;
+    if (!quick) {
+        fieldSizes.push_back(2048);
+        fieldSizes.push_back(Maze::getMaxSize());
+    }
+    benchmarkFlowField(suite, fieldSizes);
+    benchmarkRender(suite, sizes);
+    benchmarkTerminalRenderer(suite, sizes);
+    std::vector<int> viewportSizes = sizes;
+    if (!quick) {
+        viewportSizes.push_back(Maze::getMaxSize());
+    }
+    benchmarkViewport(suite, viewportSizes);
+    benchmarkGeneration(suite, sizes);
+    std::vector<int> generatorSizes = sizes;
+    if (!quick) {
+        generatorSizes.push_back(2048);
+        generatorSizes.push_back(Maze::getMaxSize());
+    }
+    benchmarkMazeAlgorithms(suite, generatorSizes);
+    std::vector<int> saveSizes = sizes;
+    if (!quick) {
+        saveSizes.push_back(Maze::getMaxSize());  // Largest supported maze, a 16 MB grid
+    }
+    benchmarkSaveLoad(suite, saveSizes);
+    benchmarkReachability(suite, quick ? 256 : 1024);
+    std::vector<int> pathSizes = sizes;
+    if (!quick) {
+        pathSizes.push_back(2048);
+    }
+    benchmarkPathfinding(suite, pathSizes);
+    benchmarkReplay(suite, quick ? 100000 : 1000000, logFiles);
+    benchmarkChunkedWorld(suite, quick ? 1024 : 16384);
+    benchmarkVectorEnv(suite, quick ? 21 : 31, quick ? 1000 : 10000);
+    benchmarkBatch(suite, quick ? 21 : 31, quick ? 200 : 1000);
+
+    suite.writeJson(std::cout);
+    return 0;
+}
@@ -8,6 +8,7 @@
  * - Moving enemies with random AI
  * - Multiple levels with increasing difficulty
  * - Save/load functionality for maze layouts
+ * - Seeded games that can be recorded and replayed exactly
  * - Object-oriented design with inheritance
  *
  * Author: Kritika
@@ -16,17 +17,67 @@
 #include "Game.h"
 #include <iostream>
 #include <cstdlib>
-#include <ctime>
+#include <cstring>
+#include <string>
 
-int main() {
+/**
+ * Replay a recorded session headlessly and check it against its recording
+ * @param filename Recording written with --record
+ * @return Process exit code: 0 if the replay matches
+ */
+static int replayRecording(const std::string& filename) {
+    InputLog log;
+    if (!log.loadFromFile(filename)) {
+        return 1;
+    }
+
+    ReplayOutcome outcome;
+    const bool matches = Game::replayLog(log, outcome);
+    const ReplayOutcome& expected = log.getOutcome();
+    std::cout << "Replayed " << log.getEventCount() << " actions over " << outcome.ticks << " ticks" << std::endl;
+    std::cout << "Level: " << outcome.level << " | Score: " << outcome.score << " | Moves: " << outcome.moves
+              << " | Player: (" << outcome.playerX << "," << outcome.playerY << ")" << std::endl;
+    if (!matches) {
+        std::cout << "MISMATCH: recording ended at level " << expected.level << ", score " << expected.score
+                  << ", moves " << expected.moves << ", player (" << expected.playerX << ","
+                  << expected.playerY << ")" << std::endl;
+        return 2;
+    }
+    std::cout << "Replay matches the recording." << std::endl;
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
     try {
-        // Seed random number generator
-        srand(static_cast<unsigned int>(time(nullptr)));
+        // A fixed seed (--seed <number>) replays the same mazes and enemy moves
+        uint64_t seed = Random::seedFromClock();
+        std::string recordFile;
+        for (int i = 1; i < argc; i++) {
+            if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+                seed = std::strtoull(argv[++i], nullptr, 10);
+            } else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+                recordFile = argv[++i];
+            } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+                return replayRecording(argv[++i]);
+            } else {
+                std::cerr << "Usage: " << argv[0]
+                          << " [--seed <number>] [--record <file>] | --replay <file>" << std::endl;
+                return 1;
+            }
+        }
 
         // Create and run the game
-        Game mazeGame;
+        Game mazeGame(Maze::getDefaultSize(), Maze::getDefaultSize(), seed);
+        if (!recordFile.empty()) {
+            mazeGame.startRecording();
+        }
         mazeGame.run();
 
+        InputLog log;
+        if (!recordFile.empty() && mazeGame.finishRecording(log) && log.saveToFile(recordFile)) {
+            std::cout << "Session recorded to " << recordFile << std::endl;
+        }
+
         std::cout << "Thanks for playing!" << std::endl;
 
     } catch (const std::exception& e) {